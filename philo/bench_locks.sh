@@ -0,0 +1,32 @@
+#!/bin/sh
+# Runs every philo-lockbench-<backend> given as argument on the same ring
+# workload, once per core count (1, 2, 4, ... up to the online CPUs), with
+# as many threads as cores and with 4x oversubscription like a real table.
+# ITERATIONS overrides the per-thread iteration count.
+
+ITERATIONS=${ITERATIONS:-200000}
+CPUS=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+
+pin() {
+	ncores=$1
+	shift
+	if command -v taskset >/dev/null 2>&1; then
+		taskset -c 0-$((ncores - 1)) "$@"
+	else
+		"$@"
+	fi
+}
+
+cores=1
+while [ "$cores" -le "$CPUS" ]; do
+	for threads in "$cores" $((cores * 4)); do
+		forks=$threads
+		[ "$forks" -lt 2 ] && forks=2
+		echo "# cores=$cores threads=$threads iterations=$ITERATIONS"
+		for lock in "$@"; do
+			pin "$cores" ./philo-lockbench-"$lock" "$threads" "$forks" \
+				"$ITERATIONS"
+		done
+	done
+	cores=$((cores * 2))
+done
@@ -0,0 +1,34 @@
+#!/bin/sh
+# Compares meal throughput of the single-process simulation against
+# --procs=P on one large table. Every run eats to completion, and meals are
+# counted from the "is eating" lines, so both modes are measured the same
+# way including start-up. Override the table with PHILOS, DIE, EAT, SLEEP
+# and MEALS, and the worker counts with PROCS.
+
+PHILOS=${PHILOS:-20000}
+DIE=${DIE:-4000}
+EAT=${EAT:-200}
+SLEEP=${SLEEP:-200}
+MEALS=${MEALS:-5}
+PROCS=${PROCS:-"2 4 8"}
+
+now_ms() {
+	date +%s%N | cut -b1-13
+}
+
+run() {
+	label=$1
+	shift
+	start=$(now_ms)
+	meals=$(./philo "$@" "$PHILOS" "$DIE" "$EAT" "$SLEEP" "$MEALS" \
+		| grep -c "is eating")
+	ms=$(($(now_ms) - start))
+	[ "$ms" -le 0 ] && ms=1
+	echo "$label: $meals meals in $ms ms, $((meals * 1000 / ms)) meals/s"
+}
+
+echo "# $PHILOS philosophers, $DIE $EAT $SLEEP, $MEALS meals each"
+run "single process"
+for procs in $PROCS; do
+	run "--procs=$procs" --procs="$procs"
+done
@@ -0,0 +1,17 @@
+#!/bin/sh
+# Compares death-detection and fork-handoff latency at normal priority
+# against --rt. Only the latency report is kept; the simulation log goes to
+# /dev/null. Run it as root (or with CAP_SYS_NICE and a raised memlock
+# limit) for --rt to take effect, and on an otherwise idle machine. Override
+# the table with PHILOS, DIE, EAT, SLEEP and MEALS.
+
+PHILOS=${PHILOS:-200}
+DIE=${DIE:-800}
+EAT=${EAT:-200}
+SLEEP=${SLEEP:-200}
+MEALS=${MEALS:-20}
+
+echo "# $PHILOS philosophers, $DIE $EAT $SLEEP, $MEALS meals each"
+./philo --latency "$PHILOS" "$DIE" "$EAT" "$SLEEP" "$MEALS" 2>&1 >/dev/null
+./philo --rt --latency "$PHILOS" "$DIE" "$EAT" "$SLEEP" "$MEALS" \
+	2>&1 >/dev/null
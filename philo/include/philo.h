@@ -6,20 +6,36 @@
 /*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/07/01 12:00:00 by AI Assistan       #+#    #+#             */
-/*   Updated: 2025/04/14 12:34:27 by nassy            ###   ########.fr       */
+/*   Updated: 2026/10/19 22:46:30 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PHILO_H
 # define PHILO_H
 
+# ifdef __linux__
+#  define _GNU_SOURCE
+# endif
+# include <errno.h>
+# include <fcntl.h>
+# include <limits.h>
+# include <math.h>
 # include <pthread.h>
+# include <sched.h>
 # include <signal.h>
 # include <stdio.h>
 # include <stdlib.h>
 # include <string.h>
+# include <sys/mman.h>
+# include <sys/resource.h>
 # include <sys/time.h>
+# include <sys/wait.h>
+# include <time.h>
 # include <unistd.h>
+# include "philo_shm.h"
+# ifdef __linux__
+#  include <sys/prctl.h>
+# endif
 
 # define PHILO_THINKING 0
 # define PHILO_EATING 1
@@ -50,14 +66,145 @@
 # define ERR_WRONG_ARG "Error: wrong number of arguments"
 # define ERR_DATA_INIT "Error: initialization failed"
 # define ERR_PHILO_INIT "Error: philosopher initialization failed"
+# define ERR_OPTION "Error: unknown option"
+# define ERR_STATS_INIT "Error: failed to create stats segment"
+# define ERR_TABLES "Error: cannot load tables from"
+# define ERR_TABLE_LINE "Error: invalid table on line"
+# define ERR_RECORD "Error: cannot write recording to"
+# define ERR_REPLAY "Error: cannot replay recording from"
 
-typedef struct s_fork
+# define ERR_TOPOLOGY "Error: invalid topology file"
+# define ERR_PROCS "Error: cannot split the table into processes"
+# define ERR_WORKER "Error: worker process lost"
+# define ERR_SCENARIO "Error: cannot load scenario from"
+# define ERR_SCENARIO_LINE "Error: invalid scenario phase on line"
+# define ERR_SCENARIO_MODE "Error: --scenario cannot be combined with"
+# define ERR_TABLES_MODE "Error: --tables cannot be combined with"
+
+# define MONITOR_PERIOD_US 1000
+# define TOPO_MAX_DEGREE 64
+# define SCHED_SLACK_MS 5
+# define SCHED_TOLERANCE_US 2000
+# define SCHED_GUARD_US 1000
+# define RECORD_MAGIC "philo-record-v2"
+# define GRANT_LOG_CHUNK 1024
+
+/*
+** A replayed fork waits at most time_to_die / REPLAY_PATIENCE_DIV for its
+** scripted taker while others ask for it; past that the replay has drifted
+** and the fork falls back to the normal protocol.
+*/
+# define REPLAY_PATIENCE_DIV 4
+
+/*
+** The fork lock backend is chosen at build time with FORK_LOCK=pthread
+** (default), spin, ticket or mcs; the matching fork_lock_<name>.c is the
+** only one compiled. A thread holds at most two fork locks at once, in
+** --schedule's assert_forks, and releases them in reverse order; the MCS
+** backend relies on both for its per-thread stack of MCS_NODES queue nodes.
+*/
+# define LOCK_SPIN_YIELD 64
+# define LOCK_BACKOFF_MIN 4
+# define LOCK_BACKOFF_MAX 1024
+# define MCS_NODES 4
+
+# if defined(FORK_LOCK_SPIN)
+#  define FORK_LOCK_NAME "spin"
+
+typedef struct s_fork_lock
+{
+	int				locked;
+}					t_fork_lock;
+# elif defined(FORK_LOCK_TICKET)
+#  define FORK_LOCK_NAME "ticket"
+
+typedef struct s_fork_lock
+{
+	unsigned int	next;
+	unsigned int	serving;
+}					t_fork_lock;
+# elif defined(FORK_LOCK_MCS)
+#  define FORK_LOCK_NAME "mcs"
+
+typedef struct s_mcs_node
+{
+	struct s_mcs_node	*next;
+	int					locked;
+}						t_mcs_node;
+
+typedef struct s_fork_lock
+{
+	t_mcs_node		*tail;
+	t_mcs_node		*owner;
+}					t_fork_lock;
+# else
+#  define FORK_LOCK_NAME "pthread"
+
+typedef struct s_fork_lock
 {
 	pthread_mutex_t	mutex;
+}					t_fork_lock;
+# endif
+
+typedef struct s_fork
+{
+	t_fork_lock		lock;
 	int				state;
 	int				owner_id;
+	int				grants;
+	long long		released_us;
+	int				*script;
+	int				script_len;
+	int				script_cut;
+	long long		script_stall;
 }					t_fork;
 
+typedef struct s_grant
+{
+	int				fork;
+	int				seq;
+	int				philo;
+}					t_grant;
+
+# define GAP_BUCKETS 64
+# define FAIR_ROWS 5
+
+/*
+** Streaming meal-gap statistics, written only by the philosopher's own
+** thread. count is meals started; each later meal closes one gap from the
+** previous meal start. The wait for the first meal only feeds max. Gaps
+** are binned linearly over [0, scale) with one overflow bucket, so the p99
+** costs a fixed GAP_BUCKETS counters for any run length, at a resolution
+** of scale / GAP_BUCKETS. scale is time_to_die in microseconds as of the
+** first meal, so a --scenario phase that changes it does not move bins
+** that are already filled.
+*/
+typedef struct s_gap
+{
+	long long		last;
+	long long		count;
+	long long		sum;
+	long long		min;
+	long long		max;
+	long long		scale;
+	int				hist[GAP_BUCKETS + 1];
+}					t_gap;
+
+/*
+** --accounting: what each thread cost, filled in once as it exits. Context
+** switches come from RUSAGE_THREAD and stay 0 where it does not exist;
+** wakeups count the usleep slices of ft_usleep.
+*/
+# define ACCT_ROWS 5
+
+typedef struct s_acct
+{
+	long long		cpu_us;
+	long long		nvcsw;
+	long long		nivcsw;
+	long long		wakeups;
+}					t_acct;
+
 typedef struct s_philo
 {
 	int				id;
@@ -66,13 +213,205 @@ typedef struct s_philo
 	int				right_fork;
 	int				eat_count;
 	long long		last_eat_time;
+	long long		wait_start;
+	int				blocked_fork;
+	long long		wait_total;
+	int				*res;
+	int				nres;
+	long long		sched_offset;
+	t_grant			*grant_log;
+	int				grant_len;
+	int				grant_cap;
+	t_gap			gap;
+	t_acct			acct;
 	pthread_t		thread;
 	struct s_data	*data;
 }					t_philo;
 
+typedef struct s_opts
+{
+	int				stats;
+	char			*tables;
+	char			*record;
+	char			*replay;
+	char			*topology;
+	int				schedule;
+	int				watchdog;
+	int				procs;
+	int				fairness;
+	int				jitter_sweep;
+	int				rt;
+	int				latency;
+	int				accounting;
+	char			*scenario;
+}					t_opts;
+
+/*
+** --jitter=DIST:PCT:MAX_US delays PCT% of the calls at each injection point
+** (the end of ft_usleep, a freshly granted fork, the print critical
+** section) by up to MAX_US. uniform draws evenly from [0, MAX_US]; exp
+** draws from an exponential with mean MAX_US / JITTER_EXP_SCALE, capped at
+** MAX_US, so most delays are short with a long tail.
+*/
+# define JITTER_UNIFORM 0
+# define JITTER_EXP 1
+# define JITTER_EXP_SCALE 4
+# define JITTER_DEFAULT_PCT 10
+# define JITTER_SWEEP_START 250
+# define JITTER_TRIALS 3
+# define JITTER_MEALS "5"
+# define JITTER_REFINE 3
+
+typedef struct s_jitter
+{
+	int				dist;
+	int				pct;
+	long long		max_us;
+	long long		injected;
+}					t_jitter;
+
+typedef struct s_sweep
+{
+	t_opts			*opts;
+	char			**argv;
+	long long		clean;
+	long long		death;
+	int				failed;
+}					t_sweep;
+
+/*
+** --rt: threads get RT_STACK_SIZE stacks and SCHED_FIFO, the monitor above
+** the philosophers, and each thread prefaults RT_PREFAULT bytes of stack.
+** Memory is locked once every thread exists. Missing privileges only
+** print a warning.
+*/
+# define RT_PRIO_PHILO 10
+# define RT_PRIO_MONITOR 20
+# define RT_STACK_SIZE 262144
+# define RT_PREFAULT 65536
+# define RT_PAGE 4096
+
+/*
+** --latency histograms are log-linear: exact below 2^LAT_SUB_BITS us, then
+** 2^LAT_SUB_BITS buckets per power of two, so any percentile is within
+** 12.5% of the true value. Samples are added with relaxed atomics from
+** any thread.
+*/
+# define LAT_SUB_BITS 3
+# define LAT_BUCKETS 256
+
+typedef struct s_lat
+{
+	long long		count;
+	long long		max;
+	long long		buckets[LAT_BUCKETS];
+}					t_lat;
+
+/*
+** --scenario=FILE: one phase per line, "AT_MS DIE EAT SLEEP [ramp]
+** [slow=N:PCT]", AT_MS counted from the start of the run and strictly
+** increasing. A ramp phase moves linearly from the previous phase's values
+** to its own by the time the next one starts; slow=N:PCT makes every Nth
+** philosopher eat and sleep PCT% longer. Phase 0 is the command line
+** unless the file has a phase at 0 ms.
+*/
+# define SCENARIO_MAX_PHASES 64
+
+typedef struct s_phase
+{
+	long long		at_ms;
+	int				die;
+	int				eat;
+	int				sleep;
+	int				ramp;
+	int				slow_every;
+	int				slow_pct;
+	long long		meals;
+	t_lat			wait;
+}					t_phase;
+
+/*
+** The values in force, all ints so they copy with word-sized atomics. The
+** monitor is the only writer and publishes them under a seqlock: seq is
+** odd while a copy is in progress, and a reader retries until it sees the
+** same even seq before and after its own copy.
+*/
+typedef struct s_timing
+{
+	int				phase;
+	int				die;
+	int				eat;
+	int				sleep;
+	int				slow_every;
+	int				slow_pct;
+}					t_timing;
+
+typedef struct s_scenario
+{
+	t_phase			phases[SCENARIO_MAX_PHASES];
+	int				count;
+	int				current;
+	unsigned int	seq;
+	t_timing		live;
+}					t_scenario;
+
+# define WATCH_SAMPLES 9
+# define WATCH_DEFAULT_PCT 50
+# define STALL_ROWS 10
+
+typedef struct s_watch
+{
+	long long		time[WATCH_SAMPLES];
+	long long		meals[WATCH_SAMPLES];
+	double			expect[WATCH_SAMPLES];
+	int				head;
+	int				count;
+	long long		interval;
+	long long		next_sample;
+	long long		window;
+	double			expected;
+	int				stalled;
+	long long		stalls;
+}					t_watch;
+
+/*
+** --procs=P state, shared by the coordinator and its worker processes.
+** Workers append status lines to the log ring under the shared print
+** mutex; only the coordinator consumes it. Status strings are stored as
+** pointers, which stay valid because every worker is a fork() of the
+** coordinator and shares its string literals.
+*/
+# define SHARD_LOG 4096
+# define SHARD_GRACE_MS 1000
+
+typedef struct s_log_entry
+{
+	long long		time;
+	char			*status;
+	int				id;
+}					t_log_entry;
+
+typedef struct s_shard
+{
+	pid_t			coordinator;
+	int				procs;
+	int				ready;
+	int				alive;
+	pid_t			*pids;
+	size_t			size;
+	long long		jitter_injected;
+	t_acct			coordinator_acct;
+	unsigned long	head;
+	unsigned long	tail;
+	t_log_entry		log[SHARD_LOG];
+}					t_shard;
+
 typedef struct s_data
 {
 	int				num_philos;
+	int				num_forks;
+	int				*res_index;
+	int				*res_list;
 	int				time_to_die;
 	int				time_to_eat;
 	int				time_to_sleep;
@@ -81,15 +420,80 @@ typedef struct s_data
 	int				sim_state;
 	int				single_philo;
 	long long		start_time;
+	long long		start_us;
+	long long		sched_period;
+	int				sched_slots;
+	int				sched_slipped;
+	long long		sched_slip_time;
+	long long		sched_slip_late;
 	t_fork			*forks;
 	pthread_mutex_t	print;
 	pthread_mutex_t	death;
 	pthread_mutex_t	start_lock;
 	pthread_mutex_t	meal_lock;
 	pthread_t		monitor_thread;
+	int				monitor_started;
+	int				started;
+	int				dead_id;
+	long long		end_time;
+	long long		end_meals;
+	FILE			*out;
 	t_philo			*philos;
+	t_opts			opts;
+	t_watch			watch;
+	long long		last_tick;
+	t_lat			lat_detect;
+	t_lat			lat_handoff;
+	t_acct			monitor_acct;
+	t_scenario		*scenario;
+	t_shard			*shard;
+	t_shm_stats		*shm;
+	char			shm_name[SHM_NAME_LEN];
 }					t_data;
 
+# define PROF_SITES 64
+# define PROF_HELD 8
+
+typedef struct s_prof_site
+{
+	const char		*name;
+	const char		*file;
+	int				line;
+	long long		acquires;
+	long long		contended;
+	long long		wait_ns;
+	long long		hold_ns;
+}					t_prof_site;
+
+typedef struct s_prof_held
+{
+	pthread_mutex_t	*mutex;
+	t_prof_site		*site;
+	long long		since;
+}					t_prof_held;
+
+typedef struct s_prof_thread
+{
+	t_prof_site				sites[PROF_SITES];
+	int						nsites;
+	t_prof_held				held[PROF_HELD];
+	int						nheld;
+	struct s_prof_thread	*next;
+}							t_prof_thread;
+
+typedef struct s_prof_registry
+{
+	t_prof_thread	*threads;
+	pthread_mutex_t	lock;
+}					t_prof_registry;
+
+typedef struct s_table_set
+{
+	t_data			*tables;
+	int				count;
+	char			*path;
+}					t_table_set;
+
 int					free_resources(t_data *data);
 int					cleanup_single_mutex(pthread_mutex_t *mutex);
 long long			get_time(void);
@@ -127,4 +531,136 @@ void				philo_sleep(t_philo *philo);
 int					cleanup_forks(t_fork *forks, int count);
 int					validate_args(int argc, char **argv);
 int					parse_args(t_data *data, int argc, char **argv);
+int					parse_options(t_data *data, int *argc, char ***argv);
+int					ft_strncmp(const char *s1, const char *s2, size_t n);
+size_t				ft_strlen(const char *str);
+long long			get_time_us(void);
+long long			get_time_ns(void);
+int					fork_lock_init(t_fork_lock *lock);
+void				fork_lock_acquire(t_fork_lock *lock);
+void				fork_lock_release(t_fork_lock *lock);
+int					fork_lock_destroy(t_fork_lock *lock);
+void				lock_relax(int *spins);
+t_prof_registry		*prof_registry(void);
+int					prof_mutex_lock(pthread_mutex_t *mutex, const char *name,
+						const char *file, int line);
+int					prof_mutex_unlock(pthread_mutex_t *mutex);
+void				prof_report(void);
+int					launch_simulation(t_data *data);
+int					start_philosophers(t_data *data);
+void				join_philosophers(t_data *data);
+int					monitor_tick(t_data *data);
+int					run_tables(t_opts *opts);
+int					load_tables(t_table_set *set, t_opts *opts);
+int					run_table_set(t_table_set *set);
+void				free_table_set(t_table_set *set);
+char				*opt_value(char *arg, char *name);
+int					fork_grantable(t_philo *philo, t_fork *fork);
+void				grant_commit(t_philo *philo);
+void				report_replay(t_data *data);
+void				free_grants(t_data *data);
+int					record_write(t_data *data);
+int					replay_load(t_data *data);
+int					topology_load(t_data *data);
+void				topology_free(t_data *data);
+void				assign_resources(t_philo *philo, t_data *data, int index);
+int					resources_available(t_philo *philo);
+int					take_resources(t_philo *philo);
+void				release_resources(t_philo *philo);
+long long			total_meals(t_data *data);
+double				ring_rate(t_data *data);
+int					live_die(t_data *data);
+int					live_eat(t_data *data);
+int					live_sleep(t_data *data);
+void				timing_read(t_scenario *sc, t_timing *out);
+void				timing_slowest(t_scenario *sc, t_timing *out);
+long long			run_time(t_data *data);
+long long			run_meals(t_data *data);
+void				report_topology(t_data *data);
+void				sleep_until_us(long long target);
+int					sched_compile(t_data *data);
+void				sched_slip(t_data *data, long long late_us);
+int					sched_slipped(t_data *data);
+void				report_schedule(t_data *data);
+void				run_schedule(t_philo *philo);
+void				watchdog_init(t_data *data);
+void				watchdog_sample(t_data *data);
+void				report_watchdog(t_data *data);
+void				stall_report(t_data *data, double rate);
+int					share_mutex(pthread_mutex_t *mutex);
+int					mutex_recover(int status, pthread_mutex_t *mutex);
+int					fork_lock_share(t_fork_lock *lock);
+t_data				*shard_share(t_data *local);
+void				shard_close(t_data *data);
+int					run_procs(t_data *local);
+void				shard_push(t_data *data, long long time, int id,
+						char *status);
+void				shard_drain(t_data *data);
+void				shard_poll(t_data *data);
+void				shard_wait(t_data *data);
+void				fairness_meal(t_philo *philo);
+long long			gap_p99(t_gap *gap);
+long long			gap_worst(t_philo *philo);
+void				report_fairness(t_data *data);
+t_jitter			*jitter_config(void);
+void				jitter_delay(void);
+char				*jitter_dist_name(int dist);
+void				report_jitter(void);
+int					jitter_parse(char *spec, int with_max);
+int					run_jitter_sweep(t_opts *opts, int argc, char **argv);
+int					thread_start(pthread_t *thread, void *(*routine)(void *),
+						void *arg, int prio);
+void				rt_prefault(t_data *data);
+void				rt_lock_memory(t_data *data);
+void				put_fork(t_data *data, int fork_index);
+void				lat_record(t_lat *lat, long long us);
+void				lat_tick(t_data *data);
+void				lat_handoff(t_philo *philo, int fork_index);
+void				report_latency(t_data *data);
+void				acct_wakeup(void);
+void				acct_finish(t_data *data, t_acct *acct);
+void				report_accounting(t_data *data);
+void				report_run(t_data *data);
+long long			lat_quantile(t_lat *lat, double q);
+int					scenario_load(t_data *data);
+void				scenario_free(t_data *data);
+void				scenario_start(t_data *data);
+void				scenario_tick(t_data *data);
+void				timing_copy(t_timing *dst, t_timing *src);
+int					timing_eat(t_philo *philo);
+int					timing_sleep(t_philo *philo);
+void				scenario_meal(t_philo *philo, long long waited);
+void				report_scenario(t_data *data);
+void				record_meal_start(t_philo *philo);
+void				record_meal_end(t_philo *philo);
+int					stats_open(t_data *data);
+void				stats_start(t_data *data);
+void				stats_close(t_data *data);
+void				stats_publish(t_philo *philo, int state);
+void				stats_add(t_data *data, int counter);
+void				stats_set_state(t_data *data, int state, int dead_id);
+void				stats_wait_begin(t_philo *philo);
+long long			stats_wait_end(t_philo *philo);
+/*
+** Every mutex lock in src/ passes its status through mutex_recover, which
+** repairs a robust --procs mutex whose owner died. `make profile` defines
+** PHILO_PROFILE and also routes every mutex operation through the counting
+** wrappers in profile.c; regular builds otherwise call pthread directly.
+** With the pthread fork lock backend, fork acquisitions carry their
+** caller's site too, instead of all landing on the one line inside
+** fork_lock_pthread.c.
+*/
+# ifdef PHILO_PROFILE
+#  define pthread_mutex_lock(m) mutex_recover(prof_mutex_lock(m, #m, \
+		__FILE__, __LINE__), m)
+#  define pthread_mutex_unlock(m) prof_mutex_unlock(m)
+#  ifdef FORK_LOCK_PTHREAD
+void				fork_lock_acquire_at(t_fork_lock *lock, const char *name,
+						const char *file, int line);
+#   define fork_lock_acquire(l) fork_lock_acquire_at(l, #l, __FILE__, __LINE__)
+#  endif
+# else
+#  define pthread_mutex_lock(m) mutex_recover(pthread_mutex_lock(m), m)
+# endif
+
 #endif
\ No newline at end of file
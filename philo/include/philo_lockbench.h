@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_lockbench.h                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 12:21:47 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_LOCKBENCH_H
+# define PHILO_LOCKBENCH_H
+
+# include "philo.h"
+
+# define BENCH_USAGE "usage: philo-lockbench threads forks iterations"
+
+typedef struct s_bench
+{
+	t_fork			*forks;
+	int				num_forks;
+	int				iterations;
+	pthread_mutex_t	start;
+}					t_bench;
+
+typedef struct s_bench_worker
+{
+	t_bench			*bench;
+	int				id;
+	long long		grants;
+	pthread_t		thread;
+}					t_bench_worker;
+
+int					bench_init(t_bench *bench, char **argv,
+						t_bench_worker **workers);
+
+#endif
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_shm.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 20:31:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_SHM_H
+# define PHILO_SHM_H
+
+# define SHM_MAGIC 0x5048494C
+# define SHM_NAME_FMT "/philo.%d"
+# define SHM_NAME_LEN 32
+
+# define STAT_MEALS 0
+# define STAT_FORK_TAKES 1
+# define STAT_ROLLBACKS 2
+# define STAT_COUNT 3
+
+/*
+** One slot per philosopher, written only by that philosopher's thread.
+** seq is a seqlock counter: odd while the slot is being rewritten, so a
+** reader retries instead of ever blocking the writer. Padded to a cache
+** line so neighbouring writers do not false-share; the segment header is
+** padded to one line too, so every slot starts on a line boundary.
+*/
+typedef struct s_shm_philo
+{
+	unsigned int	seq;
+	int				state;
+	int				eat_count;
+	int				pad0;
+	long long		last_eat_time;
+	long long		wait_total;
+	long long		wait_start;
+	char			pad1[24];
+}					t_shm_philo;
+
+typedef struct s_shm_stats
+{
+	unsigned int	magic;
+	int				num_philos;
+	int				time_to_die;
+	int				sim_state;
+	int				dead_id;
+	int				pad0;
+	long long		start_time;
+	long long		counters[STAT_COUNT];
+	char			pad1[8];
+	t_shm_philo		philos[];
+}					t_shm_stats;
+
+#endif
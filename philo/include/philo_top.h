@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_top.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:51:04 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TOP_H
+# define PHILO_TOP_H
+
+# include "philo.h"
+# include <sys/stat.h>
+
+# define TOP_BY_WAIT 0
+# define TOP_BY_DEATH 1
+# define TOP_INTERVAL 500
+# define TOP_ROWS 10
+# define TOP_USAGE "usage: philo-top <pid> [interval_ms] [rows]"
+
+typedef struct s_top_row
+{
+	int				id;
+	int				state;
+	int				eat_count;
+	long long		since_meal;
+	long long		wait_now;
+	long long		wait_total;
+}					t_top_row;
+
+typedef struct s_top
+{
+	t_shm_stats		*shm;
+	size_t			size;
+	pid_t			pid;
+	int				interval;
+	int				limit;
+	int				ranked;
+	t_top_row		*rows;
+	int				*order;
+}					t_top;
+
+void				top_snapshot(t_top *top);
+void				top_rank(t_top *top, int key);
+void				top_render(t_top *top);
+
+#endif
@@ -0,0 +1,46 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   philo_tune.h                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:48:30 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 17:48:36 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PHILO_TUNE_H
+# define PHILO_TUNE_H
+
+# include "philo.h"
+
+# define TUNE_TRIALS 16
+# define TUNE_MEALS 5
+# define TUNE_Z 1.96
+# define TUNE_USAGE "usage: philo-tune N_min N_max eat sleep [trials] [meals]"
+
+typedef struct s_tune
+{
+	int				n_min;
+	int				n_max;
+	int				eat;
+	int				sleep;
+	int				trials;
+	int				meals;
+	long long		trials_run;
+}					t_tune;
+
+typedef struct s_probe
+{
+	int				num_philos;
+	int				die;
+	int				survived;
+	int				trials;
+}					t_probe;
+
+int					run_probe(t_tune *tune, t_probe *probe);
+void				wilson_bounds(t_probe *probe, double *low, double *high);
+void				tune_philos(t_tune *tune, int num_philos);
+
+#endif
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accounting.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:07:44 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static __thread long long	g_wakeups;
+
+/*
+** Called after every voluntary sleep in the simulator: each usleep slice
+** of ft_usleep and sleep_until_us, injected jitter, and the polling loops.
+** A thread-local counter, so the hot sleep loop never shares a cache line.
+*/
+void	acct_wakeup(void)
+{
+	g_wakeups++;
+}
+
+/*
+** Called by a philosopher, monitor or --procs coordinator thread on its
+** way out; both clocks only report on the calling thread.
+*/
+void	acct_finish(t_data *data, t_acct *acct)
+{
+	struct timespec	ts;
+	struct rusage	usage;
+
+	if (!data->opts.accounting)
+		return ;
+	if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+		acct->cpu_us = ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+	memset(&usage, 0, sizeof(usage));
+#ifdef RUSAGE_THREAD
+	getrusage(RUSAGE_THREAD, &usage);
+#endif
+	acct->nvcsw = usage.ru_nvcsw;
+	acct->nivcsw = usage.ru_nivcsw;
+	acct->wakeups = g_wakeups;
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   accounting_report.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:07:44 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:53:38 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	print_acct(char *name, int id, t_acct *acct)
+{
+	fprintf(stderr, "  %s", name);
+	if (id)
+		fprintf(stderr, " %d", id);
+	fprintf(stderr, ": cpu=%.1fms wakeups=%lld csw=%lld/%lld\n",
+		acct->cpu_us / 1000.0, acct->wakeups, acct->nvcsw, acct->nivcsw);
+}
+
+/*
+** Prints the ACCT_ROWS philosophers that used the most CPU, picking the
+** largest remaining figure and then blanking it.
+*/
+static void	print_busiest(t_data *data, long long *cpu)
+{
+	int	printed;
+	int	busiest;
+	int	i;
+
+	printed = 0;
+	while (printed < ACCT_ROWS && printed < data->num_philos)
+	{
+		busiest = 0;
+		i = 0;
+		while (++i < data->num_philos)
+			if (cpu[i] > cpu[busiest])
+				busiest = i;
+		print_acct("philo", data->philos[busiest].id,
+			&data->philos[busiest].acct);
+		cpu[busiest] = -1;
+		printed++;
+	}
+}
+
+/*
+** Adds up every philosopher into total and copies their CPU times into
+** cpu. Returns the number of meals eaten.
+*/
+static long long	sum_table(t_data *data, t_acct *total, long long *cpu)
+{
+	t_acct		*acct;
+	long long	meals;
+	int			i;
+
+	memset(total, 0, sizeof(t_acct));
+	meals = 0;
+	i = -1;
+	while (++i < data->num_philos)
+	{
+		acct = &data->philos[i].acct;
+		total->cpu_us += acct->cpu_us;
+		total->nvcsw += acct->nvcsw;
+		total->nivcsw += acct->nivcsw;
+		total->wakeups += acct->wakeups;
+		cpu[i] = acct->cpu_us;
+		meals += data->philos[i].eat_count;
+	}
+	return (meals);
+}
+
+/*
+** --accounting exit report on stderr: the philosophers' combined cost per
+** meal, the monitor and any --procs coordinator on their own, then the
+** busiest philosophers. csw is voluntary/involuntary context switches.
+*/
+void	report_accounting(t_data *data)
+{
+	t_acct		total;
+	long long	*cpu;
+	long long	meals;
+
+	if (!data->opts.accounting || !data->philos)
+		return ;
+	cpu = malloc(sizeof(long long) * data->num_philos);
+	if (!cpu)
+		return ;
+	meals = sum_table(data, &total, cpu);
+	fprintf(stderr, "accounting: %lld meals", meals);
+	if (meals)
+		fprintf(stderr, ", %.3fms cpu and %.1f wakeups per meal",
+			total.cpu_us / 1000.0 / meals, (double)total.wakeups / meals);
+	fprintf(stderr, "\n");
+	print_acct("philosophers", 0, &total);
+	print_acct("monitor", 0, &data->monitor_acct);
+	if (data->shard)
+		print_acct("coordinator", 0, &data->shard->coordinator_acct);
+	print_busiest(data, cpu);
+	free(cpu);
+}
@@ -6,7 +6,7 @@
 /*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:30:13 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/14 12:16:54 by nassy            ###   ########.fr       */
+/*   Updated: 2026/10/19 22:13:20 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,25 +14,21 @@
 
 int	eat(t_philo *philo)
 {
-	long long	current_time;
-
+	stats_wait_begin(philo);
 	if (!check_and_take_both_forks_safe(philo))
 	{
 		philo_think(philo);
 		return (0);
 	}
+	scenario_meal(philo, stats_wait_end(philo));
+	grant_commit(philo);
 	pthread_mutex_lock(&philo->data->death);
 	philo->state = PHILO_EATING;
 	pthread_mutex_unlock(&philo->data->death);
 	print_status(philo, MSG_EAT);
-	current_time = get_time();
-	pthread_mutex_lock(&philo->data->meal_lock);
-	philo->last_eat_time = current_time;
-	pthread_mutex_unlock(&philo->data->meal_lock);
-	ft_usleep(philo->data->time_to_eat);
-	pthread_mutex_lock(&philo->data->meal_lock);
-	philo->eat_count++;
-	pthread_mutex_unlock(&philo->data->meal_lock);
+	record_meal_start(philo);
+	ft_usleep(timing_eat(philo));
+	record_meal_end(philo);
 	release_both_forks(philo, 0, 0);
 	return (1);
 }
@@ -44,8 +40,9 @@ void	philo_sleep(t_philo *philo)
 	pthread_mutex_lock(&philo->data->death);
 	philo->state = PHILO_SLEEPING;
 	pthread_mutex_unlock(&philo->data->death);
+	stats_publish(philo, PHILO_SLEEPING);
 	print_status(philo, MSG_SLEEP);
-	ft_usleep(philo->data->time_to_sleep);
+	ft_usleep(timing_sleep(philo));
 }
 
 void	philo_think(t_philo *philo)
@@ -55,6 +52,7 @@ void	philo_think(t_philo *philo)
 	pthread_mutex_lock(&philo->data->death);
 	philo->state = PHILO_THINKING;
 	pthread_mutex_unlock(&philo->data->death);
+	stats_wait_begin(philo);
 	print_status(philo, MSG_THINK);
 	adjust_think_time(philo);
 }
@@ -65,13 +63,13 @@ void	adjust_think_time(t_philo *philo)
 
 	if (philo->data->num_philos % 2 == 1)
 	{
-		if (philo->data->time_to_die <= 500)
+		if (live_die(philo->data) <= 500)
 			ft_usleep(5);
 		else
 		{
 			if (philo->id % 2 == 0)
 			{
-				wait_time = philo->data->time_to_eat / 4;
+				wait_time = live_eat(philo->data) / 4;
 				ft_usleep(wait_time);
 			}
 		}
@@ -6,7 +6,7 @@
 /*   By: snakajim <snakajim@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:25:09 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/12 15:26:27 by snakajim         ###   ########.fr       */
+/*   Updated: 2026/10/19 19:52:03 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,6 +14,9 @@
 
 int	free_resources(t_data *data)
 {
+	free_grants(data);
+	topology_free(data);
+	scenario_free(data);
 	if (data->philos)
 	{
 		free(data->philos);
@@ -21,13 +24,17 @@ int	free_resources(t_data *data)
 	}
 	if (data->forks)
 	{
-		cleanup_forks(data->forks, data->num_philos);
+		cleanup_forks(data->forks, data->num_forks);
 		data->forks = NULL;
 	}
 	cleanup_single_mutex(&data->print);
 	cleanup_single_mutex(&data->death);
 	cleanup_single_mutex(&data->start_lock);
 	cleanup_single_mutex(&data->meal_lock);
+	stats_close(data);
+	if (data->out && data->out != stdout)
+		fclose(data->out);
+	data->out = NULL;
 	return (0);
 }
 
@@ -51,7 +58,7 @@ int	cleanup_forks(t_fork *forks, int count)
 	success = 1;
 	while (i < count)
 	{
-		if (cleanup_single_mutex(&forks[i].mutex) != 0)
+		if (fork_lock_destroy(&forks[i].lock) != 0)
 			success = 0;
 		i++;
 	}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fairness.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:02:18 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:19:31 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Bins are laid out against time_to_die as it stood at the first meal:
+** a --scenario phase may change it later, but bins already filled keep
+** their meaning and gap_p99 reads them back on the same scale.
+*/
+static void	gap_bin(t_gap *gap, long long span)
+{
+	long long	bucket;
+
+	bucket = span * GAP_BUCKETS / gap->scale;
+	if (bucket > GAP_BUCKETS)
+		bucket = GAP_BUCKETS;
+	gap->hist[bucket]++;
+}
+
+/*
+** Closes the gap that ends at this meal start. Only the owning thread
+** writes its t_gap, so no lock is taken.
+*/
+void	fairness_meal(t_philo *philo)
+{
+	t_gap		*gap;
+	long long	now;
+	long long	span;
+
+	if (!philo->data->opts.fairness)
+		return ;
+	gap = &philo->gap;
+	now = get_time_us();
+	span = now - gap->last;
+	if (!gap->last)
+		span = now - philo->data->start_us;
+	if (span > gap->max)
+		gap->max = span;
+	gap->last = now;
+	if (gap->count++ == 0)
+	{
+		gap->scale = live_die(philo->data) * 1000LL;
+		return ;
+	}
+	if (gap->count == 2 || span < gap->min)
+		gap->min = span;
+	gap->sum += span;
+	gap_bin(gap, span);
+}
+
+/*
+** Upper edge of the bucket holding the 99th percentile gap, capped by the
+** exact maximum; 0 until there is a gap.
+*/
+long long	gap_p99(t_gap *gap)
+{
+	long long	target;
+	long long	seen;
+	long long	edge;
+	int			bucket;
+
+	if (gap->count < 2)
+		return (0);
+	target = ((gap->count - 1) * 99 + 99) / 100;
+	seen = 0;
+	bucket = 0;
+	while (bucket < GAP_BUCKETS)
+	{
+		seen += gap->hist[bucket];
+		edge = (bucket + 1) * gap->scale / GAP_BUCKETS;
+		if (seen >= target && edge < gap->max)
+			return (edge);
+		if (seen >= target)
+			return (gap->max);
+		bucket++;
+	}
+	return (gap->max);
+}
+
+/*
+** Longest gap including the one still open when the run ended, which is
+** the one that kills a philosopher.
+*/
+long long	gap_worst(t_philo *philo)
+{
+	long long	end;
+	long long	last;
+
+	end = philo->data->start_us + run_time(philo->data) * 1000;
+	last = philo->gap.last;
+	if (!last)
+		last = philo->data->start_us;
+	if (end - last > philo->gap.max)
+		return (end - last);
+	return (philo->gap.max);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fairness_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:02:18 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:19:31 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Meal rate in meals/s: completed gaps over their total, or for a
+** philosopher with fewer than two meals one meal per worst gap, the most
+** it can have achieved with that gap still open.
+*/
+static double	meal_rate(t_philo *philo)
+{
+	long long	worst;
+
+	if (philo->gap.count >= 2 && philo->gap.sum > 0)
+		return ((philo->gap.count - 1) * 1000000.0 / philo->gap.sum);
+	worst = gap_worst(philo);
+	if (worst <= 0)
+		return (0);
+	return (1000000.0 / worst);
+}
+
+/*
+** Jain's fairness index (sum x)^2 / (n * sum x^2) over meals started, or
+** over meal rates. Every philosopher counts, starved ones included. 1.0 is
+** perfectly even, 1/n means a single philosopher got everything.
+*/
+static double	jain_index(t_data *data, int by_rate)
+{
+	double	sum;
+	double	squares;
+	double	x;
+	int		i;
+
+	sum = 0;
+	squares = 0;
+	i = -1;
+	while (++i < data->num_philos)
+	{
+		x = data->philos[i].gap.count;
+		if (by_rate)
+			x = meal_rate(&data->philos[i]);
+		sum += x;
+		squares += x * x;
+	}
+	if (squares == 0)
+		return (1.0);
+	return (sum * sum / (data->num_philos * squares));
+}
+
+static void	print_philo(t_data *data, int index, long long margin)
+{
+	t_philo		*philo;
+	t_gap		*gap;
+	long long	meals;
+	long long	gaps;
+
+	philo = &data->philos[index];
+	gap = &philo->gap;
+	meals = gap->count;
+	if (meals < 1)
+		meals = 1;
+	gaps = gap->count - 1;
+	if (gaps < 1)
+		gaps = 1;
+	fprintf(stderr, "  philo %d: meals=%lld gap min/mean/p99/max="
+		"%.1f/%.1f/%.1f/%.1fms", philo->id, gap->count, gap->min / 1000.0,
+		gap->sum / 1000.0 / gaps, gap_p99(gap) / 1000.0,
+		gap->max / 1000.0);
+	fprintf(stderr, " fork_wait=%.2fms/meal margin=%.1fms\n",
+		philo->wait_total / 1000.0 / meals, margin / 1000.0);
+}
+
+/*
+** Prints the FAIR_ROWS philosophers closest to starving, picking the
+** smallest remaining margin and then blanking it.
+*/
+static void	print_worst(t_data *data, long long *margin)
+{
+	int	printed;
+	int	worst;
+	int	i;
+
+	printed = 0;
+	while (printed < FAIR_ROWS && printed < data->num_philos)
+	{
+		worst = 0;
+		i = 0;
+		while (++i < data->num_philos)
+			if (margin[i] < margin[worst])
+				worst = i;
+		print_philo(data, worst, margin[worst]);
+		margin[worst] = LLONG_MAX;
+		printed++;
+	}
+}
+
+/*
+** --fairness exit report on stderr. The starvation margin is time_to_die
+** minus the worst gap, open gap included, so a negative margin is a death.
+*/
+void	report_fairness(t_data *data)
+{
+	long long	*margin;
+	long long	p99;
+	int			i;
+
+	if (!data->opts.fairness || !data->philos)
+		return ;
+	margin = malloc(sizeof(long long) * data->num_philos);
+	if (!margin)
+		return ;
+	p99 = 0;
+	i = -1;
+	while (++i < data->num_philos)
+	{
+		margin[i] = data->time_to_die * 1000LL
+			- gap_worst(&data->philos[i]);
+		if (gap_p99(&data->philos[i].gap) > p99)
+			p99 = gap_p99(&data->philos[i].gap);
+	}
+	fprintf(stderr, "fairness: Jain index %.4f (meals), %.4f (meal rate) "
+		"over %d philosophers, worst gap p99 %.1fms\n",
+		jain_index(data, 0), jain_index(data, 1), data->num_philos,
+		p99 / 1000.0);
+	print_worst(data, margin);
+	free(margin);
+}
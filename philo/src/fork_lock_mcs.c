@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_mcs.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:31:07 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static __thread t_mcs_node	g_mcs_nodes[MCS_NODES];
+static __thread int			g_mcs_depth;
+
+int	fork_lock_init(t_fork_lock *lock)
+{
+	lock->tail = NULL;
+	lock->owner = NULL;
+	return (0);
+}
+
+/*
+** MCS queue lock: every waiter spins on its own node, so a release touches
+** exactly one waiter's cache line. Nodes come from a small per-thread stack:
+** fork locks nest at most two deep (assert_forks) and are released in
+** reverse order, well within MCS_NODES.
+*/
+void	fork_lock_acquire(t_fork_lock *lock)
+{
+	t_mcs_node	*node;
+	t_mcs_node	*prev;
+	int			spins;
+
+	node = &g_mcs_nodes[g_mcs_depth++];
+	node->next = NULL;
+	node->locked = 1;
+	prev = __atomic_exchange_n(&lock->tail, node, __ATOMIC_ACQ_REL);
+	spins = 0;
+	if (prev)
+	{
+		__atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+		while (__atomic_load_n(&node->locked, __ATOMIC_ACQUIRE))
+			lock_relax(&spins);
+	}
+	lock->owner = node;
+}
+
+void	fork_lock_release(t_fork_lock *lock)
+{
+	t_mcs_node	*node;
+	t_mcs_node	*next;
+	int			spins;
+
+	node = lock->owner;
+	next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+	spins = 0;
+	if (!next)
+	{
+		if (__atomic_compare_exchange_n(&lock->tail, &node, NULL, 0,
+				__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		{
+			g_mcs_depth--;
+			return ;
+		}
+		node = lock->owner;
+		while (!next)
+		{
+			next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+			if (!next)
+				lock_relax(&spins);
+		}
+	}
+	__atomic_store_n(&next->locked, 0, __ATOMIC_RELEASE);
+	g_mcs_depth--;
+}
+
+int	fork_lock_destroy(t_fork_lock *lock)
+{
+	(void)lock;
+	return (0);
+}
+
+/*
+** Waiters link their per-thread queue nodes into the lock, and another
+** process cannot see those nodes, so MCS locks cannot be shared.
+*/
+int	fork_lock_share(t_fork_lock *lock)
+{
+	(void)lock;
+	return (1);
+}
@@ -0,0 +1,48 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_pthread.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 20:52:19 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	fork_lock_init(t_fork_lock *lock)
+{
+	return (pthread_mutex_init(&lock->mutex, NULL) != 0);
+}
+
+#ifdef PHILO_PROFILE
+
+void	fork_lock_acquire_at(t_fork_lock *lock, const char *name,
+		const char *file, int line)
+{
+	prof_mutex_lock(&lock->mutex, name, file, line);
+}
+#else
+
+void	fork_lock_acquire(t_fork_lock *lock)
+{
+	pthread_mutex_lock(&lock->mutex);
+}
+#endif
+
+void	fork_lock_release(t_fork_lock *lock)
+{
+	pthread_mutex_unlock(&lock->mutex);
+}
+
+int	fork_lock_destroy(t_fork_lock *lock)
+{
+	return (cleanup_single_mutex(&lock->mutex));
+}
+
+int	fork_lock_share(t_fork_lock *lock)
+{
+	return (share_mutex(&lock->mutex));
+}
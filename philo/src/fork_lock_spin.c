@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_spin.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 16:24:51 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	fork_lock_init(t_fork_lock *lock)
+{
+	lock->locked = 0;
+	return (0);
+}
+
+/*
+** Test-and-test-and-set: spin on a plain load so waiters share the cache
+** line read-only, and only attempt the exchange once the lock looks free.
+** Failed exchanges back off exponentially.
+*/
+void	fork_lock_acquire(t_fork_lock *lock)
+{
+	int	backoff;
+	int	spins;
+	int	i;
+
+	backoff = LOCK_BACKOFF_MIN;
+	spins = 0;
+	while (1)
+	{
+		while (__atomic_load_n(&lock->locked, __ATOMIC_RELAXED))
+			lock_relax(&spins);
+		if (!__atomic_exchange_n(&lock->locked, 1, __ATOMIC_ACQUIRE))
+			return ;
+		i = 0;
+		while (i++ < backoff)
+			lock_relax(&spins);
+		if (backoff < LOCK_BACKOFF_MAX)
+			backoff *= 2;
+	}
+}
+
+void	fork_lock_release(t_fork_lock *lock)
+{
+	__atomic_store_n(&lock->locked, 0, __ATOMIC_RELEASE);
+}
+
+int	fork_lock_destroy(t_fork_lock *lock)
+{
+	(void)lock;
+	return (0);
+}
+
+/*
+** The lock word is a plain atomic, which works unchanged once it lives in
+** memory shared between processes.
+*/
+int	fork_lock_share(t_fork_lock *lock)
+{
+	(void)lock;
+	return (0);
+}
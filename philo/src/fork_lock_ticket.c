@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fork_lock_ticket.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 16:24:51 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+int	fork_lock_init(t_fork_lock *lock)
+{
+	lock->next = 0;
+	lock->serving = 0;
+	return (0);
+}
+
+/*
+** FIFO ticket lock: each waiter draws a ticket and spins until it is
+** served, so a philosopher cannot be overtaken on the same fork.
+*/
+void	fork_lock_acquire(t_fork_lock *lock)
+{
+	unsigned int	ticket;
+	int				spins;
+
+	ticket = __atomic_fetch_add(&lock->next, 1, __ATOMIC_RELAXED);
+	spins = 0;
+	while (__atomic_load_n(&lock->serving, __ATOMIC_ACQUIRE) != ticket)
+		lock_relax(&spins);
+}
+
+void	fork_lock_release(t_fork_lock *lock)
+{
+	__atomic_store_n(&lock->serving, lock->serving + 1, __ATOMIC_RELEASE);
+}
+
+int	fork_lock_destroy(t_fork_lock *lock)
+{
+	(void)lock;
+	return (0);
+}
+
+/*
+** The lock word is a plain atomic, which works unchanged once it lives in
+** memory shared between processes.
+*/
+int	fork_lock_share(t_fork_lock *lock)
+{
+	(void)lock;
+	return (0);
+}
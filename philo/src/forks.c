@@ -6,7 +6,7 @@
 /*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:26:46 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/14 12:36:24 by nassy            ###   ########.fr       */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,33 +19,33 @@ int	can_take_fork(t_philo *philo, int fork_index)
 {
 	int	can_take;
 
-	pthread_mutex_lock(&philo->data->forks[fork_index].mutex);
+	fork_lock_acquire(&philo->data->forks[fork_index].lock);
 	can_take = (philo->data->forks[fork_index].state == FORK_AVAILABLE);
-	pthread_mutex_unlock(&philo->data->forks[fork_index].mutex);
+	if (!can_take)
+		philo->blocked_fork = fork_index;
+	fork_lock_release(&philo->data->forks[fork_index].lock);
 	return (can_take);
 }
 
 int	take_fork_safe(t_philo *philo, int fork_index)
 {
-	pthread_mutex_lock(&philo->data->forks[fork_index].mutex);
-	if (philo->data->forks[fork_index].state == FORK_AVAILABLE)
-	{
-		philo->data->forks[fork_index].state = FORK_IN_USE;
-		philo->data->forks[fork_index].owner_id = philo->id;
-		pthread_mutex_unlock(&philo->data->forks[fork_index].mutex);
-		print_status(philo, MSG_FORK);
-		return (1);
-	}
-	else if (philo->id == philo->data->num_philos && 
-			time_since_last_meal(philo) > (philo->data->time_to_die * 3 / 4))
+	t_fork	*fork;
+
+	fork = &philo->data->forks[fork_index];
+	fork_lock_acquire(&fork->lock);
+	if (fork_grantable(philo, fork))
 	{
-		philo->data->forks[fork_index].state = FORK_IN_USE;
-		philo->data->forks[fork_index].owner_id = philo->id;
-		pthread_mutex_unlock(&philo->data->forks[fork_index].mutex);
+		lat_handoff(philo, fork_index);
+		fork->state = FORK_IN_USE;
+		fork->owner_id = philo->id;
+		fork_lock_release(&fork->lock);
+		jitter_delay();
+		stats_add(philo->data, STAT_FORK_TAKES);
 		print_status(philo, MSG_FORK);
 		return (1);
 	}
-	pthread_mutex_unlock(&philo->data->forks[fork_index].mutex);
+	philo->blocked_fork = fork_index;
+	fork_lock_release(&fork->lock);
 	return (0);
 }
 
@@ -56,9 +56,11 @@ int	check_and_take_both_forks_safe(t_philo *philo)
 	if (philo->data->single_philo)
 	{
 		take_fork_safe(philo, philo->left_fork);
-		ft_usleep(philo->data->time_to_die + 1);
+		ft_usleep(live_die(philo->data) + 1);
 		return (0);
 	}
+	if (philo->res)
+		return (take_resources(philo));
 	return (check_and_take_both_forks(philo, 0, 0));
 }
 
@@ -83,16 +85,20 @@ static int	check_and_take_both_forks(t_philo *philo, int first_fork, int second_
 		return (0);
 	if (!take_fork_safe(philo, second_fork))
 	{
-		pthread_mutex_lock(&philo->data->forks[first_fork].mutex);
-		philo->data->forks[first_fork].state = FORK_AVAILABLE;
-		philo->data->forks[first_fork].owner_id = -1;
-		return (pthread_mutex_unlock(&philo->data->forks[first_fork].mutex),0);
+		put_fork(philo->data, first_fork);
+		stats_add(philo->data, STAT_ROLLBACKS);
+		return (0);
 	}
 	return (1);
 }
 
 void	release_both_forks(t_philo *philo, int first_fork, int second_fork)
 {
+	if (philo->res)
+	{
+		release_resources(philo);
+		return ;
+	}
 	if (philo->id == philo->data->num_philos)
 	{
 		first_fork = philo->right_fork;
@@ -108,12 +114,6 @@ void	release_both_forks(t_philo *philo, int first_fork, int second_fork)
 		first_fork = philo->right_fork;
 		second_fork = philo->left_fork;
 	}
-	pthread_mutex_lock(&philo->data->forks[first_fork].mutex);
-	philo->data->forks[first_fork].state = FORK_AVAILABLE;
-	philo->data->forks[first_fork].owner_id = -1;
-	pthread_mutex_unlock(&philo->data->forks[first_fork].mutex);
-	pthread_mutex_lock(&philo->data->forks[second_fork].mutex);
-	philo->data->forks[second_fork].state = FORK_AVAILABLE;
-	philo->data->forks[second_fork].owner_id = -1;
-	pthread_mutex_unlock(&philo->data->forks[second_fork].mutex);
+	put_fork(philo->data, first_fork);
+	put_fork(philo->data, second_fork);
 }
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grants.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:02:19 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** In --replay mode a fork may only be granted to the philosopher the
+** recording lists for its next turn; once the script is exhausted the
+** fork falls back to the normal protocol. So does a fork whose scripted
+** taker keeps others waiting past the patience limit, or whose refused
+** asker could no longer sit out one more meal before dying; script_cut
+** keeps the turn where that happened. Called with the fork locked.
+*/
+static int	grant_allowed(t_philo *philo, t_fork *fork)
+{
+	t_data		*data;
+	long long	now;
+
+	if (!fork->script || fork->script_cut >= 0
+		|| fork->grants >= fork->script_len
+		|| fork->script[fork->grants] == philo->id)
+		return (1);
+	data = philo->data;
+	now = get_time();
+	if (!fork->script_stall)
+		fork->script_stall = now;
+	if (now - fork->script_stall < live_die(data) / REPLAY_PATIENCE_DIV
+		&& live_die(data) - time_since_last_meal(philo)
+		>= 2 * live_eat(data))
+		return (0);
+	fork->script_cut = fork->grants;
+	return (1);
+}
+
+/*
+** Whether take_fork_safe may hand this fork to philo, fork locked. On the
+** ring the last philosopher may also claim a busy fork once it has gone
+** three quarters of time_to_die without eating; resource graphs keep
+** strict exclusion.
+*/
+int	fork_grantable(t_philo *philo, t_fork *fork)
+{
+	if (fork->state != FORK_AVAILABLE
+		&& (philo->res || philo->id != philo->data->num_philos
+			|| time_since_last_meal(philo) <= live_die(philo->data) * 3 / 4))
+		return (0);
+	return (grant_allowed(philo, fork));
+}
+
+static int	grow_log(t_philo *philo)
+{
+	t_grant	*grown;
+	int		cap;
+
+	cap = philo->grant_cap * 2;
+	if (cap == 0)
+		cap = GRANT_LOG_CHUNK;
+	grown = realloc(philo->grant_log, sizeof(t_grant) * cap);
+	if (!grown)
+		return (1);
+	philo->grant_log = grown;
+	philo->grant_cap = cap;
+	return (0);
+}
+
+/*
+** --record appends to a buffer private to the philosopher's thread, so
+** recording adds no shared writes to the fork hot path.
+*/
+static void	grant_record(t_philo *philo, int fork_index)
+{
+	t_fork	*fork;
+	t_grant	*grant;
+	int		seq;
+
+	fork = &philo->data->forks[fork_index];
+	fork_lock_acquire(&fork->lock);
+	seq = fork->grants++;
+	fork->script_stall = 0;
+	fork_lock_release(&fork->lock);
+	if (!philo->data->opts.record)
+		return ;
+	if (philo->grant_len == philo->grant_cap && grow_log(philo) != 0)
+		return ;
+	grant = &philo->grant_log[philo->grant_len++];
+	grant->fork = fork_index;
+	grant->seq = seq;
+	grant->philo = philo->id;
+}
+
+/*
+** Called once philo holds every fork of a meal. Only grants that led to a
+** meal take a turn: whether a take rolls back depends on timing, so a
+** rolled-back take must not use up the turn the recording gave it.
+*/
+void	grant_commit(t_philo *philo)
+{
+	int	i;
+
+	if (!philo->data->opts.record && !philo->data->opts.replay)
+		return ;
+	if (!philo->res)
+	{
+		grant_record(philo, philo->left_fork);
+		grant_record(philo, philo->right_fork);
+		return ;
+	}
+	i = 0;
+	while (i < philo->nres)
+		grant_record(philo, philo->res[i++]);
+}
@@ -6,7 +6,7 @@
 /*   By: snakajim <snakajim@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:21:27 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/12 15:24:04 by snakajim         ###   ########.fr       */
+/*   Updated: 2026/10/19 20:04:17 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,6 +20,8 @@ int	init_data(t_data *data, int argc, char **argv)
 		return (1);
 	data->is_dead = 0;
 	data->sim_state = SIM_RUNNING;
+	data->dead_id = 0;
+	data->out = stdout;
 	if (data->num_philos == 1)
 		data->single_philo = 1;
 	else
@@ -63,21 +65,25 @@ int	init_forks(t_data *data)
 {
 	int	i;
 
-	data->forks = malloc(sizeof(t_fork) * data->num_philos);
+	data->forks = malloc(sizeof(t_fork) * data->num_forks);
 	if (!data->forks)
 		return (1);
 	i = 0;
-	while (i < data->num_philos)
+	while (i < data->num_forks)
 	{
-		if (pthread_mutex_init(&data->forks[i].mutex, NULL) != 0)
+		if (fork_lock_init(&data->forks[i].lock) != 0)
 		{
 			while (--i >= 0)
-				cleanup_single_mutex(&data->forks[i].mutex);
+				fork_lock_destroy(&data->forks[i].lock);
 			free(data->forks);
 			return (1);
 		}
 		data->forks[i].state = FORK_AVAILABLE;
 		data->forks[i].owner_id = -1;
+		data->forks[i].grants = 0;
+		data->forks[i].released_us = 0;
+		data->forks[i].script = NULL;
+		data->forks[i].script_len = 0;
 		i++;
 	}
 	return (0);
@@ -87,7 +93,7 @@ int	init_philos(t_data *data)
 {
 	int	i;
 
-	data->philos = malloc(sizeof(t_philo) * data->num_philos);
+	data->philos = calloc(data->num_philos, sizeof(t_philo));
 	if (!data->philos)
 		return (1);
 	i = 0;
@@ -97,8 +103,9 @@ int	init_philos(t_data *data)
 		data->philos[i].state = PHILO_THINKING;
 		data->philos[i].left_fork = i;
 		data->philos[i].right_fork = (i + 1) % data->num_philos;
-		data->philos[i].eat_count = 0;
-		data->philos[i].last_eat_time = 0;
+		if (data->res_index)
+			assign_resources(&data->philos[i], data, i);
+		data->philos[i].blocked_fork = -1;
 		data->philos[i].data = data;
 		i++;
 	}
@@ -119,5 +126,9 @@ int	parse_args(t_data *data, int argc, char **argv)
 		|| data->time_to_eat <= 0 || data->time_to_sleep <= 0 || (argc == 6
 			&& data->must_eat <= 0))
 		return (1);
+	data->num_forks = data->num_philos;
+	watchdog_init(data);
+	if (data->opts.topology)
+		return (topology_load(data));
 	return (0);
 }
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jitter.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:48:36 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static __thread unsigned int	g_jitter_seed;
+
+t_jitter	*jitter_config(void)
+{
+	static t_jitter	config = {JITTER_EXP, JITTER_DEFAULT_PCT, 0, 0};
+
+	return (&config);
+}
+
+/*
+** xorshift32 with one state per thread, so drawing a delay never touches
+** a shared cache line. The seed mixes the state's own address with the
+** clock on first use.
+*/
+static unsigned int	jitter_random(void)
+{
+	unsigned int	x;
+
+	x = g_jitter_seed;
+	if (x == 0)
+		x = (unsigned int)(get_time_us() ^ (long long)&g_jitter_seed) | 1;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	g_jitter_seed = x;
+	return (x);
+}
+
+/*
+** Injection point. With jitter off this is one load and a compare.
+*/
+void	jitter_delay(void)
+{
+	t_jitter	*config;
+	long long	delay;
+	double		u;
+
+	config = jitter_config();
+	if (config->max_us <= 0)
+		return ;
+	if (jitter_random() % 100 >= (unsigned int)config->pct)
+		return ;
+	u = (jitter_random() + 1.0) / 4294967297.0;
+	if (config->dist == JITTER_EXP)
+		delay = -log(u) * config->max_us / JITTER_EXP_SCALE;
+	else
+		delay = u * config->max_us;
+	if (delay > config->max_us)
+		delay = config->max_us;
+	__atomic_fetch_add(&config->injected, 1, __ATOMIC_RELAXED);
+	usleep(delay);
+	acct_wakeup();
+}
+
+char	*jitter_dist_name(int dist)
+{
+	if (dist == JITTER_EXP)
+		return ("exp");
+	return ("uniform");
+}
+
+void	report_jitter(void)
+{
+	t_jitter	*config;
+
+	config = jitter_config();
+	if (config->max_us <= 0)
+		return ;
+	fprintf(stderr, "jitter: %lld delays injected (%s, %d%% of calls, max "
+		"%lldus)\n", config->injected, jitter_dist_name(config->dist),
+		config->pct, config->max_us);
+}
@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jitter_sweep.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 17:48:36 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 17:48:36 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Parses DIST:PCT, followed by :MAX_US when with_max is set.
+*/
+int	jitter_parse(char *spec, int with_max)
+{
+	t_jitter	*config;
+	char		*end;
+
+	config = jitter_config();
+	if (ft_strncmp(spec, "uniform:", 8) == 0)
+	{
+		config->dist = JITTER_UNIFORM;
+		spec += 8;
+	}
+	else if (ft_strncmp(spec, "exp:", 4) == 0)
+	{
+		config->dist = JITTER_EXP;
+		spec += 4;
+	}
+	else
+		return (1);
+	config->pct = strtol(spec, &end, 10);
+	if (end == spec || config->pct <= 0 || config->pct > 100)
+		return (1);
+	if (!with_max)
+		return (*end != '\0');
+	if (*end != ':')
+		return (1);
+	config->max_us = strtol(end + 1, &spec, 10);
+	return (spec == end + 1 || *spec != '\0' || config->max_us <= 0);
+}
+
+/*
+** One quiet run of the scenario through the multi-table runner. Returns 1
+** if a philosopher died, -1 if the table could not be set up.
+*/
+static int	sweep_run(t_sweep *sweep)
+{
+	t_table_set	set;
+	t_data		table;
+	int			died;
+
+	memset(&set, 0, sizeof(t_table_set));
+	memset(&table, 0, sizeof(t_data));
+	table.opts = *sweep->opts;
+	table.opts.stats = 0;
+	table.opts.record = NULL;
+	table.opts.replay = NULL;
+	if (init_data(&table, 6, sweep->argv) != 0)
+		return (-1);
+	table.out = NULL;
+	if (init_philos(&table) != 0)
+		return (free_resources(&table), -1);
+	if (table.opts.schedule)
+		sched_compile(&table);
+	set.tables = &table;
+	set.count = 1;
+	run_table_set(&set);
+	died = (table.dead_id != 0);
+	free_resources(&table);
+	return (died);
+}
+
+/*
+** Runs up to JITTER_TRIALS times at one maximum delay and stops at the
+** first death. Returns 1 if the level is fatal.
+*/
+static int	sweep_level(t_sweep *sweep, long long max_us)
+{
+	int	died;
+	int	trial;
+
+	jitter_config()->max_us = max_us;
+	jitter_config()->injected = 0;
+	died = 0;
+	trial = 0;
+	while (died == 0 && trial++ < JITTER_TRIALS)
+		died = sweep_run(sweep);
+	if (died < 0)
+		return (printf("%s\n", ERR_DATA_INIT), sweep->failed = 1, 1);
+	printf("max %7lldus: ", max_us);
+	if (died)
+		printf("death in run %d", trial);
+	else
+		printf("%d/%d runs survived", JITTER_TRIALS, JITTER_TRIALS);
+	printf(", %lld delays injected\n", jitter_config()->injected);
+	return (died);
+}
+
+/*
+** Starts without jitter, doubles the maximum delay until a run dies, then
+** bisects between the last clean level and the first fatal one
+** JITTER_REFINE times. death stays -1 if nothing died up to the limit.
+*/
+static void	sweep_search(t_sweep *sweep, long long limit)
+{
+	long long	level;
+	long long	mid;
+	int			i;
+
+	sweep->death = -1;
+	level = 0;
+	while (sweep->death < 0 && level <= limit)
+	{
+		if (sweep_level(sweep, level))
+			sweep->death = level;
+		else
+			sweep->clean = level;
+		level = level * 2 + (level == 0) * JITTER_SWEEP_START;
+	}
+	i = 0;
+	while (sweep->death > 0 && !sweep->failed && i++ < JITTER_REFINE
+		&& sweep->death - sweep->clean > 1)
+	{
+		mid = (sweep->clean + sweep->death) / 2;
+		if (sweep_level(sweep, mid))
+			sweep->death = mid;
+		else
+			sweep->clean = mid;
+	}
+}
+
+/*
+** --jitter-sweep[=DIST:PCT]: finds how much injected delay the scenario
+** tolerates before the first death. Without a meal count every run stops
+** after JITTER_MEALS meals each.
+*/
+int	run_jitter_sweep(t_opts *opts, int argc, char **argv)
+{
+	t_sweep	sweep;
+	char	*args[6];
+
+	if (argc != 5 && argc != 6)
+		return (printf("%s\n", ERR_WRONG_ARG), 1);
+	memset(&sweep, 0, sizeof(t_sweep));
+	memcpy(args, argv, sizeof(char *) * argc);
+	if (argc == 5)
+		args[5] = JITTER_MEALS;
+	sweep.opts = opts;
+	sweep.argv = args;
+	printf("jitter sweep: %s %s %s %s %s, %s delays on %d%% of calls\n",
+		args[1], args[2], args[3], args[4], args[5],
+		jitter_dist_name(jitter_config()->dist), jitter_config()->pct);
+	sweep_search(&sweep, ft_atoi(args[2]) * 1000LL);
+	if (sweep.failed)
+		return (1);
+	if (sweep.death == 0)
+		printf("dies without jitter\n");
+	else if (sweep.death < 0)
+		printf("no death up to %lldus\n", sweep.clean);
+	else
+		printf("first death at %lldus, clean at %lldus\n", sweep.death,
+			sweep.clean);
+	return (0);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:31:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 18:31:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	lat_bucket(long long us)
+{
+	int	msb;
+	int	bucket;
+
+	if (us < (1 << LAT_SUB_BITS))
+		return (us);
+	msb = 63 - __builtin_clzll(us);
+	bucket = (msb - LAT_SUB_BITS + 1) * (1 << LAT_SUB_BITS)
+		+ ((us >> (msb - LAT_SUB_BITS)) & ((1 << LAT_SUB_BITS) - 1));
+	if (bucket >= LAT_BUCKETS)
+		return (LAT_BUCKETS - 1);
+	return (bucket);
+}
+
+void	lat_record(t_lat *lat, long long us)
+{
+	long long	max;
+
+	if (us < 0)
+		us = 0;
+	__atomic_add_fetch(&lat->buckets[lat_bucket(us)], 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&lat->count, 1, __ATOMIC_RELAXED);
+	max = __atomic_load_n(&lat->max, __ATOMIC_RELAXED);
+	while (us > max)
+		if (__atomic_compare_exchange_n(&lat->max, &max, us, 0,
+				__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			break ;
+}
+
+/*
+** A death is noticed on the first monitor pass after it happens, so the
+** gap between two passes bounds the death-detection latency.
+*/
+void	lat_tick(t_data *data)
+{
+	long long	now;
+
+	if (!data->opts.latency)
+		return ;
+	now = get_time_us();
+	if (data->last_tick)
+		lat_record(&data->lat_detect, now - data->last_tick);
+	data->last_tick = now;
+}
+
+/*
+** Called under the fork lock at a grant. A handoff is the time from a
+** release to the grant, for a philosopher whose last refusal was this very
+** fork. Every grant clears the release, so only the first taker after it
+** can count one.
+*/
+void	lat_handoff(t_philo *philo, int fork_index)
+{
+	t_fork	*fork;
+
+	fork = &philo->data->forks[fork_index];
+	if (philo->blocked_fork == fork_index)
+	{
+		if (philo->data->opts.latency && fork->released_us)
+			lat_record(&philo->data->lat_handoff,
+				get_time_us() - fork->released_us);
+		philo->blocked_fork = -1;
+	}
+	fork->released_us = 0;
+}
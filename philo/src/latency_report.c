@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:31:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 19:52:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long long	lat_upper(int bucket)
+{
+	int	octave;
+	int	sub;
+
+	if (bucket < (1 << LAT_SUB_BITS))
+		return (bucket);
+	octave = bucket / (1 << LAT_SUB_BITS) - 1;
+	sub = bucket % (1 << LAT_SUB_BITS);
+	return ((((1LL << LAT_SUB_BITS) + sub + 1) << octave) - 1);
+}
+
+/*
+** Upper edge of the bucket holding quantile q, capped by the exact maximum.
+*/
+long long	lat_quantile(t_lat *lat, double q)
+{
+	long long	target;
+	long long	seen;
+	int			bucket;
+
+	target = (long long)ceil(lat->count * q);
+	seen = 0;
+	bucket = 0;
+	while (bucket < LAT_BUCKETS)
+	{
+		seen += lat->buckets[bucket];
+		if (seen >= target && lat_upper(bucket) < lat->max)
+			return (lat_upper(bucket));
+		if (seen >= target)
+			return (lat->max);
+		bucket++;
+	}
+	return (lat->max);
+}
+
+static void	print_row(char *name, t_lat *lat)
+{
+	fprintf(stderr, "  %-16s %9lld %9lld %9lld %9lld %9lld\n", name,
+		lat_quantile(lat, 0.50), lat_quantile(lat, 0.99),
+		lat_quantile(lat, 0.999), lat->max, lat->count);
+}
+
+void	report_latency(t_data *data)
+{
+	char	*mode;
+
+	if (!data->opts.latency)
+		return ;
+	mode = "normal";
+	if (data->opts.rt)
+		mode = "rt";
+	fprintf(stderr, "latency (us), %s scheduling\n", mode);
+	fprintf(stderr, "  %-16s %9s %9s %9s %9s %9s\n", "", "p50", "p99",
+		"p99.9", "max", "samples");
+	print_row("death detection", &data->lat_detect);
+	print_row("fork handoff", &data->lat_handoff);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:04:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Creates the philosopher threads and returns with start_lock still held,
+** so the caller decides when they are released. data->started counts the
+** threads that actually exist, which is what the join side relies on.
+*/
+int	start_philosophers(t_data *data)
+{
+	int	i;
+
+	data->start_time = get_time();
+	data->start_us = get_time_us();
+	stats_start(data);
+	pthread_mutex_lock(&data->start_lock);
+	i = 0;
+	while (i < data->num_philos)
+	{
+		data->philos[i].last_eat_time = get_time();
+		if (thread_start(&data->philos[i].thread, philo_routine,
+				&data->philos[i], data->opts.rt * RT_PRIO_PHILO) != 0)
+			return (data->started = i, 1);
+		i++;
+	}
+	data->started = i;
+	return (0);
+}
+
+int	launch_simulation(t_data *data)
+{
+	if (start_philosophers(data) != 0)
+		return (handle_thread_creation_error(data, ERR_CREATE_THREAD));
+	if (thread_start(&data->monitor_thread, monitor_routine, data,
+			data->opts.rt * RT_PRIO_MONITOR) != 0)
+		return (handle_thread_creation_error(data, ERR_CREATE_MONITOR));
+	data->monitor_started = 1;
+	rt_lock_memory(data);
+	pthread_mutex_unlock(&data->start_lock);
+	return (0);
+}
+
+void	join_philosophers(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->started)
+	{
+		pthread_join(data->philos[i].thread, NULL);
+		i++;
+	}
+}
+
+/*
+** End-of-run reports on stderr, each a no-op unless its option is set.
+*/
+void	report_run(t_data *data)
+{
+	report_topology(data);
+	report_schedule(data);
+	report_watchdog(data);
+	report_fairness(data);
+	report_jitter();
+	report_latency(data);
+	report_accounting(data);
+	report_scenario(data);
+	report_replay(data);
+}
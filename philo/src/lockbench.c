@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lockbench.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 12:21:47 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_lockbench.h"
+
+/*
+** Same critical sections as take_fork_safe and release_both_forks: lock,
+** test and flip the fork state, unlock. Worker i works on forks i and i+1
+** of the ring, so neighbours contend exactly as philosophers do.
+*/
+static int	bench_take(t_fork *fork, int id)
+{
+	int	taken;
+
+	fork_lock_acquire(&fork->lock);
+	taken = (fork->state == FORK_AVAILABLE);
+	if (taken)
+	{
+		fork->state = FORK_IN_USE;
+		fork->owner_id = id;
+	}
+	fork_lock_release(&fork->lock);
+	return (taken);
+}
+
+static void	bench_put(t_fork *fork)
+{
+	fork_lock_acquire(&fork->lock);
+	fork->state = FORK_AVAILABLE;
+	fork->owner_id = -1;
+	fork_lock_release(&fork->lock);
+}
+
+static void	*bench_worker(void *arg)
+{
+	t_bench_worker	*worker;
+	t_fork			*left;
+	t_fork			*right;
+	int				i;
+
+	worker = (t_bench_worker *)arg;
+	left = &worker->bench->forks[worker->id % worker->bench->num_forks];
+	right = &worker->bench->forks[(worker->id + 1)
+		% worker->bench->num_forks];
+	pthread_mutex_lock(&worker->bench->start);
+	pthread_mutex_unlock(&worker->bench->start);
+	i = 0;
+	while (i++ < worker->bench->iterations)
+	{
+		if (!bench_take(left, worker->id))
+			continue ;
+		if (bench_take(right, worker->id))
+		{
+			worker->grants++;
+			bench_put(right);
+		}
+		bench_put(left);
+	}
+	return (NULL);
+}
+
+static long long	run_bench(t_bench *bench, t_bench_worker *workers,
+		int threads, long long *elapsed)
+{
+	long long	grants;
+	int			i;
+
+	pthread_mutex_lock(&bench->start);
+	i = 0;
+	while (i < threads && pthread_create(&workers[i].thread, NULL,
+			bench_worker, &workers[i]) == 0)
+		i++;
+	*elapsed = get_time_ns();
+	pthread_mutex_unlock(&bench->start);
+	grants = 0;
+	while (i-- > 0)
+	{
+		pthread_join(workers[i].thread, NULL);
+		grants += workers[i].grants;
+	}
+	*elapsed = get_time_ns() - *elapsed;
+	if (*elapsed <= 0)
+		*elapsed = 1;
+	return (grants);
+}
+
+int	main(int argc, char **argv)
+{
+	t_bench			bench;
+	t_bench_worker	*workers;
+	long long		elapsed;
+	long long		grants;
+	int				threads;
+
+	threads = -1;
+	if (argc == 4 && !validate_args(argc, argv))
+		threads = bench_init(&bench, argv, &workers);
+	if (threads < 0)
+		return (printf("%s\n", BENCH_USAGE), 1);
+	grants = run_bench(&bench, workers, threads, &elapsed);
+	printf("%-8s %4d threads %12lld grants %12.0f grants/s\n",
+		FORK_LOCK_NAME, threads, grants, grants * 1e9 / elapsed);
+	free(workers);
+	free(bench.forks);
+	pthread_mutex_destroy(&bench.start);
+	return (0);
+}
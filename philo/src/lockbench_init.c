@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lockbench_init.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:47 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 12:21:47 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_lockbench.h"
+
+int	bench_init(t_bench *bench, char **argv, t_bench_worker **workers)
+{
+	int	threads;
+	int	i;
+
+	threads = ft_atoi(argv[1]);
+	bench->num_forks = ft_atoi(argv[2]);
+	bench->iterations = ft_atoi(argv[3]);
+	if (threads <= 0 || bench->num_forks <= 1 || bench->iterations <= 0)
+		return (-1);
+	bench->forks = calloc(bench->num_forks, sizeof(t_fork));
+	*workers = calloc(threads, sizeof(t_bench_worker));
+	if (!bench->forks || !*workers)
+		return (free(bench->forks), free(*workers), -1);
+	i = -1;
+	while (++i < bench->num_forks)
+		fork_lock_init(&bench->forks[i].lock);
+	i = -1;
+	while (++i < threads)
+	{
+		(*workers)[i].bench = bench;
+		(*workers)[i].id = i;
+	}
+	pthread_mutex_init(&bench->start, NULL);
+	return (threads);
+}
@@ -6,7 +6,7 @@
 /*   By: snakajim <snakajim@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:16:35 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/12 15:45:56 by snakajim         ###   ########.fr       */
+/*   Updated: 2026/10/19 22:46:30 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,33 +20,64 @@ static int	initialize_philos(t_data *data, int argc, char **argv)
 		return (printf("%s\n", ERR_DATA_INIT), 1);
 	if (init_philos(data) != 0)
 		return (printf("%s\n", ERR_PHILO_INIT), free_resources(data), 1);
+	if (data->opts.stats && stats_open(data) != 0)
+		return (printf("%s\n", ERR_STATS_INIT), free_resources(data), 1);
+	if (data->opts.replay && replay_load(data) != 0)
+		return (free_resources(data), 1);
+	if (data->opts.scenario && scenario_load(data) != 0)
+		return (free_resources(data), 1);
+	if (data->opts.schedule)
+		sched_compile(data);
 	return (0);
 }
 
+/*
+** A scenario drives the timings of one dynamic single-process run, so the
+** runners that never load it are refused up front.
+*/
+static int	scenario_refused(t_opts *opts)
+{
+	char	*name;
+
+	name = NULL;
+	if (!opts->scenario)
+		return (0);
+	if (opts->schedule)
+		name = "--schedule";
+	else if (opts->procs)
+		name = "--procs";
+	else if (opts->tables)
+		name = "--tables";
+	else if (opts->jitter_sweep)
+		name = "--jitter-sweep";
+	if (!name)
+		return (0);
+	printf("%s %s\n", ERR_SCENARIO_MODE, name);
+	return (1);
+}
+
 int	main(int argc, char **argv)
 {
 	t_data	data;
-	int		i;
 
+	memset(&data, 0, sizeof(t_data));
+	if (parse_options(&data, &argc, &argv) != 0
+		|| scenario_refused(&data.opts))
+		return (1);
+	if (data.opts.tables)
+		return (run_tables(&data.opts));
+	if (data.opts.jitter_sweep)
+		return (run_jitter_sweep(&data.opts, argc, argv));
 	if (initialize_philos(&data, argc, argv) != 0)
 		return (1);
-	data.start_time = get_time();
-	pthread_mutex_lock(&data.start_lock);
-	i = 0;
-	while (i < data.num_philos)
-	{
-		data.philos[i].last_eat_time = get_time();
-		if (pthread_create(&data.philos[i].thread, NULL, philo_routine,
-				&data.philos[i]) != 0)
-			return (handle_thread_creation_error(&data, ERR_CREATE_THREAD));
-		i++;
-	}
-	if (i == data.num_philos)
-	{
-		if (pthread_create(&data.monitor_thread, NULL, monitor_routine,
-				&data) != 0)
-			return (handle_thread_creation_error(&data, ERR_CREATE_MONITOR));
-	}
-	return (pthread_mutex_unlock(&data.start_lock), handle_termination(&data),
-		free_resources(&data), 0);
+	if (data.opts.procs)
+		return (run_procs(&data));
+	if (launch_simulation(&data) != 0)
+		return (1);
+	handle_termination(&data);
+	record_write(&data);
+	report_run(&data);
+	free_resources(&data);
+	prof_report();
+	return (0);
 }
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   meals.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 17:02:18 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	record_meal_start(t_philo *philo)
+{
+	long long	current_time;
+
+	current_time = get_time();
+	pthread_mutex_lock(&philo->data->meal_lock);
+	philo->last_eat_time = current_time;
+	pthread_mutex_unlock(&philo->data->meal_lock);
+	fairness_meal(philo);
+	stats_publish(philo, PHILO_EATING);
+}
+
+void	record_meal_end(t_philo *philo)
+{
+	pthread_mutex_lock(&philo->data->meal_lock);
+	philo->eat_count++;
+	pthread_mutex_unlock(&philo->data->meal_lock);
+	stats_add(philo->data, STAT_MEALS);
+	stats_publish(philo, PHILO_EATING);
+}
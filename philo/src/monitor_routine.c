@@ -6,7 +6,7 @@
 /*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 14:55:58 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/14 08:43:52 by nassy            ###   ########.fr       */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,12 +14,14 @@
 
 static void	*handle_single_philosopher(t_data *data)
 {
-	ft_usleep(data->time_to_die + 1);
+	sleep_until_us(get_time_us() + (live_die(data) + 1) * 1000LL);
 	pthread_mutex_lock(&data->death);
 	data->is_dead = 1;
+	data->dead_id = 1;
 	data->philos[0].state = PHILO_DEAD;
 	pthread_mutex_unlock(&data->death);
 	print_status(&data->philos[0], MSG_DIED);
+	stats_set_state(data, SIM_STOPPED, 1);
 	set_simulation_state(data, SIM_STOPPED);
 	return (NULL);
 }
@@ -33,7 +35,7 @@ static int	is_philosopher_dead(t_data *data, int philo_index)
 	last_meal_time = data->philos[philo_index].last_eat_time;
 	pthread_mutex_unlock(&data->meal_lock);
 	elapsed = time_elapsed(last_meal_time);
-	return (elapsed > data->time_to_die);
+	return (elapsed > live_die(data));
 }
 
 static void	*handle_philosopher_death(t_data *data, int philo_index)
@@ -42,9 +44,11 @@ static void	*handle_philosopher_death(t_data *data, int philo_index)
 	if (!data->is_dead)
 	{
 		data->philos[philo_index].state = PHILO_DEAD;
+		data->dead_id = philo_index + 1;
 		data->is_dead = 1;
 		pthread_mutex_unlock(&data->death);
 		print_status(&data->philos[philo_index], MSG_DIED);
+		stats_set_state(data, SIM_STOPPED, philo_index + 1);
 		set_simulation_state(data, SIM_STOPPED);
 		return (NULL);
 	}
@@ -52,38 +56,48 @@ static void	*handle_philosopher_death(t_data *data, int philo_index)
 	return (NULL);
 }
 
-static void	*run_monitoring_loop(t_data *data)
+/*
+** One full pass over the table. Returns 0 once the simulation is over, so
+** the same step can drive a single table or be shared across many.
+*/
+int	monitor_tick(t_data *data)
 {
 	int	i;
 
+	shard_poll(data);
+	lat_tick(data);
+	scenario_tick(data);
+	if (!is_state(data, SIM_RUNNING))
+		return (0);
 	i = 0;
-	while (is_state(data, SIM_RUNNING))
+	while (i < data->num_philos)
 	{
-		if (i < data->num_philos)
-		{
-			if (is_philosopher_dead(data, i))
-				return (handle_philosopher_death(data, i), NULL);
-			i++;
-		}
-		else
-		{
-			i = 0;
-			if (check_all_ate(data) && is_state(data, SIM_RUNNING))
-				return (handle_meal_completion(data), NULL);
-			ft_usleep(1);
-		}
+		if (is_philosopher_dead(data, i))
+			return (handle_philosopher_death(data, i), 0);
+		i++;
 	}
-	return (NULL);
+	if (check_all_ate(data) && is_state(data, SIM_RUNNING))
+		return (handle_meal_completion(data), 0);
+	watchdog_sample(data);
+	return (1);
 }
 
+/*
+** The monitor sleeps with sleep_until_us rather than ft_usleep, so --jitter
+** only ever delays philosophers and never the death checks themselves.
+*/
 void	*monitor_routine(void *arg)
 {
 	t_data	*data;
 
 	data = (t_data *)arg;
+	rt_prefault(data);
 	pthread_mutex_lock(&data->start_lock);
 	pthread_mutex_unlock(&data->start_lock);
 	if (data->single_philo)
-		return (handle_single_philosopher(data), NULL);
-	return (run_monitoring_loop(data), NULL);
+		handle_single_philosopher(data);
+	while (!data->single_philo && monitor_tick(data))
+		sleep_until_us(get_time_us() + MONITOR_PERIOD_US);
+	acct_finish(data, &data->monitor_acct);
+	return (NULL);
 }
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mutex.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:24:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** --procs puts its mutexes in shared memory. On Linux they are robust, so
+** a worker that dies inside a critical section does not wedge the
+** coordinator: the next locker is handed the lock with EOWNERDEAD, and
+** mutex_recover makes it usable again.
+*/
+int	share_mutex(pthread_mutex_t *mutex)
+{
+	pthread_mutexattr_t	attr;
+	int					failed;
+
+	if (pthread_mutexattr_init(&attr) != 0)
+		return (1);
+	failed = (pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED)
+			!= 0);
+#ifdef __linux__
+	if (!failed)
+		failed = (pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST)
+				!= 0);
+#endif
+	if (!failed)
+		failed = (pthread_mutex_init(mutex, &attr) != 0);
+	pthread_mutexattr_destroy(&attr);
+	return (failed);
+}
+
+/*
+** Every pthread_mutex_lock in src/ ends here with the lock's status. A
+** lock that came back EOWNERDEAD is held by the caller but flagged as
+** inconsistent; marking it consistent keeps it a working mutex instead of
+** one that fails every later lock once it is released. The data it guards
+** is left as the dead worker wrote it, which is fine: losing a worker
+** already ends the run with SIM_ERROR.
+*/
+int	mutex_recover(int status, pthread_mutex_t *mutex)
+{
+#ifdef __linux__
+	if (status == EOWNERDEAD && pthread_mutex_consistent(mutex) == 0)
+		return (0);
+#else
+	(void)mutex;
+#endif
+	return (status);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   options.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 19:52:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	is_flag(char *arg, char *name)
+{
+	return (ft_strncmp(arg, name, ft_strlen(name) + 1) == 0);
+}
+
+/*
+** Numeric option values must be plain positive integers; anything else
+** leaves -1 behind so parse_options can reject the option.
+*/
+static int	opt_number(char *arg, char *name)
+{
+	char	*value;
+	int		i;
+
+	value = opt_value(arg, name);
+	i = 0;
+	while (value[i] >= '0' && value[i] <= '9')
+		i++;
+	if (i == 0 || value[i] != '\0' || ft_atoi(value) <= 0)
+		return (-1);
+	return (ft_atoi(value));
+}
+
+static int	set_flag(t_opts *opts, char *arg)
+{
+	if (is_flag(arg, "--stats"))
+		opts->stats = 1;
+	else if (is_flag(arg, "--schedule"))
+		opts->schedule = 1;
+	else if (is_flag(arg, "--fairness"))
+		opts->fairness = 1;
+	else if (is_flag(arg, "--jitter-sweep"))
+		opts->jitter_sweep = 1;
+	else if (is_flag(arg, "--rt"))
+		opts->rt = 1;
+	else if (is_flag(arg, "--latency"))
+		opts->latency = 1;
+	else if (is_flag(arg, "--accounting"))
+		opts->accounting = 1;
+	else if (is_flag(arg, "--watchdog"))
+		opts->watchdog = WATCH_DEFAULT_PCT;
+	else if (opt_value(arg, "--watchdog="))
+		opts->watchdog = opt_number(arg, "--watchdog=");
+	else if (opt_value(arg, "--procs="))
+		opts->procs = opt_number(arg, "--procs=");
+	else
+		return (1);
+	return (opts->watchdog < 0 || opts->procs < 0);
+}
+
+static int	set_option(t_opts *opts, char *arg)
+{
+	if (set_flag(opts, arg) == 0)
+		return (0);
+	if (opt_value(arg, "--tables="))
+		opts->tables = opt_value(arg, "--tables=");
+	else if (opt_value(arg, "--record="))
+		opts->record = opt_value(arg, "--record=");
+	else if (opt_value(arg, "--replay="))
+		opts->replay = opt_value(arg, "--replay=");
+	else if (opt_value(arg, "--topology="))
+		opts->topology = opt_value(arg, "--topology=");
+	else if (opt_value(arg, "--scenario="))
+		opts->scenario = opt_value(arg, "--scenario=");
+	else if (opt_value(arg, "--jitter="))
+		return (jitter_parse(opt_value(arg, "--jitter="), 1));
+	else if (opt_value(arg, "--jitter-sweep="))
+		return (opts->jitter_sweep = 1,
+			jitter_parse(opt_value(arg, "--jitter-sweep="), 0));
+	else
+		return (1);
+	return (0);
+}
+
+int	parse_options(t_data *data, int *argc, char ***argv)
+{
+	int	i;
+
+	i = 1;
+	while (i < *argc && ft_strncmp((*argv)[i], "--", 2) == 0)
+	{
+		if (set_option(&data->opts, (*argv)[i]) != 0)
+			return (printf("%s: %s\n", ERR_OPTION, (*argv)[i]), 1);
+		i++;
+	}
+	(*argv)[i - 1] = (*argv)[0];
+	*argv += i - 1;
+	*argc -= i - 1;
+	return (0);
+}
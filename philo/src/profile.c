@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:30:05 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:24:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+#ifdef PHILO_PROFILE
+# undef pthread_mutex_lock
+# undef pthread_mutex_unlock
+
+static __thread t_prof_thread	*g_prof_self;
+
+t_prof_registry	*prof_registry(void)
+{
+	static t_prof_registry	registry = {NULL, PTHREAD_MUTEX_INITIALIZER};
+
+	return (&registry);
+}
+
+/*
+** Counters live in a block private to the calling thread, so recording an
+** acquisition never takes a shared lock. The block is only linked into the
+** registry once, on the thread's first lock.
+*/
+static t_prof_thread	*prof_self(void)
+{
+	t_prof_registry	*registry;
+
+	if (g_prof_self)
+		return (g_prof_self);
+	g_prof_self = calloc(1, sizeof(t_prof_thread));
+	if (!g_prof_self)
+		return (NULL);
+	registry = prof_registry();
+	pthread_mutex_lock(&registry->lock);
+	g_prof_self->next = registry->threads;
+	registry->threads = g_prof_self;
+	pthread_mutex_unlock(&registry->lock);
+	return (g_prof_self);
+}
+
+static t_prof_site	*prof_site(t_prof_thread *self, const char *name,
+		const char *file, int line)
+{
+	int	i;
+
+	i = 0;
+	while (i < self->nsites)
+	{
+		if (self->sites[i].line == line && self->sites[i].name == name
+			&& self->sites[i].file == file)
+			return (&self->sites[i]);
+		i++;
+	}
+	if (self->nsites == PROF_SITES)
+		return (NULL);
+	self->sites[i].name = name;
+	self->sites[i].file = file;
+	self->sites[i].line = line;
+	self->nsites++;
+	return (&self->sites[i]);
+}
+
+int	prof_mutex_lock(pthread_mutex_t *mutex, const char *name,
+		const char *file, int line)
+{
+	t_prof_thread	*self;
+	t_prof_site		*site;
+	long long		start;
+	int				status;
+	int				contended;
+
+	self = prof_self();
+	start = get_time_ns();
+	status = pthread_mutex_trylock(mutex);
+	contended = (status == EBUSY);
+	if (contended)
+		status = pthread_mutex_lock(mutex);
+	if ((status != 0 && status != EOWNERDEAD) || !self)
+		return (status);
+	site = prof_site(self, name, file, line);
+	if (!site || self->nheld == PROF_HELD)
+		return (status);
+	site->acquires++;
+	site->contended += contended;
+	self->held[self->nheld].mutex = mutex;
+	self->held[self->nheld].site = site;
+	self->held[self->nheld].since = get_time_ns();
+	site->wait_ns += (self->held[self->nheld].since - start) * contended;
+	self->nheld++;
+	return (status);
+}
+
+int	prof_mutex_unlock(pthread_mutex_t *mutex)
+{
+	t_prof_thread	*self;
+	int				i;
+
+	self = g_prof_self;
+	i = 0;
+	if (self)
+		i = self->nheld;
+	while (--i >= 0)
+	{
+		if (self->held[i].mutex == mutex)
+		{
+			self->held[i].site->hold_ns += get_time_ns()
+				- self->held[i].since;
+			self->held[i] = self->held[--self->nheld];
+			break ;
+		}
+	}
+	return (pthread_mutex_unlock(mutex));
+}
+
+#endif
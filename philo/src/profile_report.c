@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   profile_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:30:05 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 11:30:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+#ifdef PHILO_PROFILE
+
+static int	merge_site(t_prof_site *merged, int count, t_prof_site *site)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		if (merged[i].line == site->line
+			&& strcmp(merged[i].name, site->name) == 0
+			&& strcmp(merged[i].file, site->file) == 0)
+		{
+			merged[i].acquires += site->acquires;
+			merged[i].contended += site->contended;
+			merged[i].wait_ns += site->wait_ns;
+			merged[i].hold_ns += site->hold_ns;
+			return (count);
+		}
+		i++;
+	}
+	merged[count] = *site;
+	return (count + 1);
+}
+
+/*
+** Folds every thread's private counters into one array keyed by lock name
+** and call site. Only valid once all profiled threads have been joined.
+*/
+static int	collect_sites(t_prof_registry *registry, t_prof_site **out)
+{
+	t_prof_thread	*thread;
+	int				total;
+	int				count;
+	int				i;
+
+	total = 0;
+	thread = registry->threads;
+	while (thread)
+	{
+		total += thread->nsites;
+		thread = thread->next;
+	}
+	*out = malloc(sizeof(t_prof_site) * (total + 1));
+	if (!*out)
+		return (0);
+	count = 0;
+	thread = registry->threads;
+	while (thread)
+	{
+		i = 0;
+		while (i < thread->nsites)
+			count = merge_site(*out, count, &thread->sites[i++]);
+		thread = thread->next;
+	}
+	return (count);
+}
+
+static void	sort_sites(t_prof_site *sites, int count)
+{
+	t_prof_site	key;
+	int			i;
+	int			j;
+
+	i = 1;
+	while (i < count)
+	{
+		key = sites[i];
+		j = i - 1;
+		while (j >= 0 && (sites[j].wait_ns < key.wait_ns
+				|| (sites[j].wait_ns == key.wait_ns
+					&& sites[j].hold_ns < key.hold_ns)))
+		{
+			sites[j + 1] = sites[j];
+			j--;
+		}
+		sites[j + 1] = key;
+		i++;
+	}
+}
+
+static void	print_site(t_prof_site *site, int rank)
+{
+	double	acquires;
+
+	acquires = site->acquires;
+	if (acquires == 0)
+		acquires = 1;
+	fprintf(stderr, "%4d %10lld %9lld %5.1f%% %9.2f %8.2f %9.2f %8.2f  "
+		"%s @ %s:%d\n", rank, site->acquires, site->contended,
+		100.0 * site->contended / acquires, site->wait_ns / 1e6,
+		site->wait_ns / 1e3 / acquires, site->hold_ns / 1e6,
+		site->hold_ns / 1e3 / acquires, site->name, site->file, site->line);
+}
+
+void	prof_report(void)
+{
+	t_prof_registry	*registry;
+	t_prof_site		*sites;
+	int				count;
+	int				i;
+
+	registry = prof_registry();
+	count = collect_sites(registry, &sites);
+	sort_sites(sites, count);
+	fprintf(stderr, "\nlock profile, ranked by wait time\n%4s %10s %9s %6s "
+		"%9s %8s %9s %8s  %s\n", "rank", "acquires", "contended", "cont",
+		"wait_ms", "avg_us", "hold_ms", "avg_us", "lock @ site");
+	i = 0;
+	while (i < count)
+	{
+		print_site(&sites[i], i + 1);
+		i++;
+	}
+	free(sites);
+}
+
+#else
+
+void	prof_report(void)
+{
+}
+
+#endif
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   record.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:02:19 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:04:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	count_grants(t_data *data, int *per_fork)
+{
+	int	total;
+	int	i;
+	int	j;
+
+	total = 0;
+	i = -1;
+	while (++i < data->num_philos)
+	{
+		j = -1;
+		while (++j < data->philos[i].grant_len)
+			per_fork[data->philos[i].grant_log[j].fork]++;
+		total += data->philos[i].grant_len;
+	}
+	return (total);
+}
+
+/*
+** Per-fork sequence numbers are unique and dense, so merging the thread
+** buffers is a counting sort: each grant goes straight to its final slot.
+*/
+static t_grant	*merge_grants(t_data *data, int *total)
+{
+	t_grant	*merged;
+	int		*offset;
+	t_grant	*grant;
+	int		i;
+	int		j;
+
+	offset = calloc(data->num_forks + 1, sizeof(int));
+	if (!offset)
+		return (NULL);
+	*total = count_grants(data, offset + 1);
+	i = 0;
+	while (++i <= data->num_forks)
+		offset[i] += offset[i - 1];
+	merged = malloc(sizeof(t_grant) * (*total + 1));
+	i = -1;
+	while (merged && ++i < data->num_philos)
+	{
+		j = -1;
+		while (++j < data->philos[i].grant_len)
+		{
+			grant = &data->philos[i].grant_log[j];
+			merged[offset[grant->fork] + grant->seq] = *grant;
+		}
+	}
+	return (free(offset), merged);
+}
+
+int	record_write(t_data *data)
+{
+	FILE	*file;
+	t_grant	*merged;
+	int		total;
+	int		i;
+
+	if (!data->opts.record)
+		return (0);
+	file = fopen(data->opts.record, "w");
+	if (!file)
+		return (printf("%s %s\n", ERR_RECORD, data->opts.record), 1);
+	merged = merge_grants(data, &total);
+	if (!merged)
+		return (fclose(file), printf("%s %s\n", ERR_RECORD,
+				data->opts.record), 1);
+	fprintf(file, "%s %d %d %d %d %d\n", RECORD_MAGIC, data->num_philos,
+		data->time_to_die, data->time_to_eat, data->time_to_sleep,
+		data->must_eat);
+	i = -1;
+	while (++i < total)
+		fprintf(file, "%d %d %d\n", merged[i].fork, merged[i].seq,
+			merged[i].philo);
+	fclose(file);
+	free(merged);
+	return (0);
+}
+
+void	free_grants(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (data->philos && i < data->num_philos)
+	{
+		free(data->philos[i].grant_log);
+		data->philos[i].grant_log = NULL;
+		i++;
+	}
+	i = 0;
+	while (data->forks && i < data->num_forks)
+	{
+		free(data->forks[i].script);
+		data->forks[i].script = NULL;
+		i++;
+	}
+}
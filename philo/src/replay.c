@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:02:19 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:04:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static FILE	*open_recording(t_data *data)
+{
+	FILE	*file;
+	char	magic[16];
+	int		args[4];
+
+	file = fopen(data->opts.replay, "r");
+	if (!file)
+		return (NULL);
+	if (fscanf(file, "%15s %d %d %d %d %*d", magic, &args[0], &args[1],
+			&args[2], &args[3]) != 5
+		|| ft_strncmp(magic, RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0
+		|| args[0] != data->num_philos || args[1] != data->time_to_die
+		|| args[2] != data->time_to_eat || args[3] != data->time_to_sleep)
+		return (fclose(file), NULL);
+	return (file);
+}
+
+static int	count_turns(t_data *data, FILE *file)
+{
+	int	fork;
+	int	seq;
+	int	philo;
+
+	while (fscanf(file, "%d %d %d", &fork, &seq, &philo) == 3)
+	{
+		if (fork < 0 || fork >= data->num_forks || philo < 1
+			|| philo > data->num_philos)
+			return (1);
+		data->forks[fork].script_len++;
+	}
+	return (!feof(file));
+}
+
+static int	alloc_scripts(t_data *data)
+{
+	int	i;
+
+	i = 0;
+	while (i < data->num_forks)
+	{
+		data->forks[i].script = calloc(data->forks[i].script_len + 1,
+				sizeof(int));
+		if (!data->forks[i].script)
+			return (1);
+		data->forks[i].script_cut = -1;
+		data->forks[i].script_stall = 0;
+		i++;
+	}
+	return (0);
+}
+
+static int	fill_scripts(t_data *data, FILE *file)
+{
+	int	fork;
+	int	seq;
+	int	philo;
+
+	while (fscanf(file, "%d %d %d", &fork, &seq, &philo) == 3)
+	{
+		if (seq < 0 || seq >= data->forks[fork].script_len)
+			return (1);
+		data->forks[fork].script[seq] = philo;
+	}
+	return (0);
+}
+
+/*
+** Loads a --record file into one grant script per fork. The file is read
+** twice: once to size each script, once to place every turn at its
+** sequence number.
+*/
+int	replay_load(t_data *data)
+{
+	FILE	*file;
+	long	body;
+
+	file = open_recording(data);
+	if (!file)
+		return (printf("%s %s\n", ERR_REPLAY, data->opts.replay), 1);
+	body = ftell(file);
+	if (count_turns(data, file) != 0 || alloc_scripts(data) != 0
+		|| fseek(file, body, SEEK_SET) != 0 || fill_scripts(data, file) != 0)
+		return (fclose(file), free_grants(data),
+			printf("%s %s\n", ERR_REPLAY, data->opts.replay), 1);
+	fclose(file);
+	return (0);
+}
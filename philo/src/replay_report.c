@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   replay_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:02:10 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:04:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long long	replayed_turns(t_fork *fork)
+{
+	if (fork->script_cut >= 0)
+		return (fork->script_cut);
+	if (fork->grants < fork->script_len)
+		return (fork->grants);
+	return (fork->script_len);
+}
+
+/*
+** --replay exit report on stderr: how much of the recording was followed,
+** and how many forks dropped out of it after a stalled turn.
+*/
+void	report_replay(t_data *data)
+{
+	long long	turns;
+	long long	replayed;
+	int			cut;
+	int			i;
+
+	if (!data->opts.replay || !data->forks)
+		return ;
+	turns = 0;
+	replayed = 0;
+	cut = 0;
+	i = -1;
+	while (++i < data->num_forks)
+	{
+		turns += data->forks[i].script_len;
+		replayed += replayed_turns(&data->forks[i]);
+		cut += data->forks[i].script_cut >= 0;
+	}
+	fprintf(stderr, "replay: %lld of %lld recorded turns replayed", replayed,
+		turns);
+	if (cut)
+		fprintf(stderr, ", diverged on %d forks (normal protocol after)", cut);
+	fprintf(stderr, "\n");
+}
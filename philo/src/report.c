@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:55:41 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:10:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+long long	total_meals(t_data *data)
+{
+	long long	meals;
+	int			i;
+
+	meals = 0;
+	pthread_mutex_lock(&data->meal_lock);
+	i = 0;
+	while (i < data->num_philos)
+		meals += data->philos[i++].eat_count;
+	pthread_mutex_unlock(&data->meal_lock);
+	return (meals);
+}
+
+/*
+** Best sustainable meals per second on the plain ring: at most N/2
+** philosophers eat at once, and nobody eats more than once per eat+sleep.
+** Under --scenario the current phase's slowdown counts for everyone.
+*/
+double	ring_rate(t_data *data)
+{
+	t_timing	timing;
+	double		by_forks;
+	double		by_cycle;
+
+	timing.eat = live_eat(data);
+	timing.sleep = live_sleep(data);
+	if (data->scenario)
+		timing_slowest(data->scenario, &timing);
+	by_forks = (data->num_philos / 2) * 1000.0 / timing.eat;
+	by_cycle = data->num_philos * 1000.0 / (timing.eat + timing.sleep);
+	if (by_cycle < by_forks)
+		return (by_cycle);
+	return (by_forks);
+}
+
+long long	run_time(t_data *data)
+{
+	long long	end;
+
+	end = data->end_time;
+	if (end == 0)
+		end = get_time();
+	if (end - data->start_time <= 0)
+		return (1);
+	return (end - data->start_time);
+}
+
+/*
+** Meals eaten up to the moment the simulation ended; threads may still
+** finish a meal in flight before they notice the stop.
+*/
+long long	run_meals(t_data *data)
+{
+	if (data->end_time)
+		return (data->end_meals);
+	return (total_meals(data));
+}
+
+void	report_topology(t_data *data)
+{
+	double	rate;
+	double	ring;
+	int		degree;
+	int		i;
+
+	if (!data->res_index)
+		return ;
+	degree = 0;
+	i = -1;
+	while (++i < data->num_philos)
+		if (data->philos[i].nres > degree)
+			degree = data->philos[i].nres;
+	rate = run_meals(data) * 1000.0 / run_time(data);
+	ring = ring_rate(data);
+	fprintf(stderr, "topology: %d philosophers, %d resources, max degree "
+		"%d\nthroughput %.2f meals/s, ring baseline %.2f meals/s (%.1f%%)\n",
+		data->num_philos, data->num_forks, degree, rate, ring,
+		100.0 * rate / ring);
+}
@@ -6,7 +6,7 @@
 /*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:39:10 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/14 12:37:54 by nassy            ###   ########.fr       */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,13 +19,20 @@ void *philo_routine(void *arg)
     t_philo *philo;
 
     philo = (t_philo *)arg;
+    rt_prefault(philo->data);
     pthread_mutex_lock(&philo->data->start_lock);
     pthread_mutex_unlock(&philo->data->start_lock);
     if (philo->data->single_philo)
-        return (print_status(philo, MSG_FORK), ft_usleep(philo->data->time_to_die), NULL);
+    {
+        print_status(philo, MSG_FORK);
+        ft_usleep(live_die(philo->data));
+        return (acct_finish(philo->data, &philo->acct), NULL);
+    }
+    if (philo->data->sched_period)
+        return (run_schedule(philo), philo_simulation_loop(philo));
     if (philo->id % 2 == 0)
     {
-        ft_usleep(philo->data->time_to_eat / 2);
+        ft_usleep(live_eat(philo->data) / 2);
         philo_think(philo);
         try_get_forks(philo);
     }
@@ -45,11 +52,12 @@ static void *philo_simulation_loop(t_philo *philo)
         else
         {
             if (philo->id == philo->data->num_philos)
-                ft_usleep(philo->data->time_to_eat);
+                ft_usleep(live_eat(philo->data));
             else
-                ft_usleep(philo->data->time_to_eat / 2);
+                ft_usleep(live_eat(philo->data) / 2);
         }
     }
+    acct_finish(philo->data, &philo->acct);
     return (NULL);
 }
 
@@ -67,7 +75,11 @@ void	print_status(t_philo *philo, char *status)
 	long long	time;
 
 	pthread_mutex_lock(&philo->data->print);
+	jitter_delay();
 	time = time_elapsed(philo->data->start_time);
-	printf("%lld %d %s\n", time, philo->id, status);
+	if (philo->data->shard)
+		shard_push(philo->data, time, philo->id, status);
+	else if (philo->data->out)
+		fprintf(philo->data->out, "%lld %d %s\n", time, philo->id, status);
 	pthread_mutex_unlock(&philo->data->print);
 }
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rt.c                                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:31:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 18:31:12 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	g_rt_warned;
+
+/*
+** pthread_create with, for a non-zero prio, a small fixed stack and
+** SCHED_FIFO at that priority. A thread that cannot get real-time
+** scheduling keeps running at normal priority; the first such failure in
+** the process prints one warning.
+*/
+int	thread_start(pthread_t *thread, void *(*routine)(void *), void *arg,
+		int prio)
+{
+	pthread_attr_t		attr;
+	struct sched_param	param;
+	int					status;
+
+	if (prio == 0)
+		return (pthread_create(thread, NULL, routine, arg));
+	if (pthread_attr_init(&attr) != 0)
+		return (1);
+	pthread_attr_setstacksize(&attr, RT_STACK_SIZE);
+	status = pthread_create(thread, &attr, routine, arg);
+	pthread_attr_destroy(&attr);
+	if (status != 0)
+		return (status);
+	memset(&param, 0, sizeof(param));
+	param.sched_priority = prio;
+	status = pthread_setschedparam(*thread, SCHED_FIFO, &param);
+	if (status != 0 && !g_rt_warned)
+	{
+		g_rt_warned = 1;
+		fprintf(stderr, "rt: SCHED_FIFO unavailable (%s), running at "
+			"normal priority\n", strerror(status));
+	}
+	return (0);
+}
+
+/*
+** Touches the stack this thread is about to use, one page at a time, so
+** the simulation never takes a first-touch fault on it.
+*/
+void	rt_prefault(t_data *data)
+{
+	char			stack[RT_PREFAULT];
+	volatile char	*page;
+	int				i;
+
+	if (!data->opts.rt)
+		return ;
+	page = stack;
+	i = 0;
+	while (i < RT_PREFAULT)
+	{
+		page[i] = 0;
+		i += RT_PAGE;
+	}
+}
+
+/*
+** Called once every thread exists and before any is released, so locking
+** what is mapped now covers the tables and all thread stacks. Future
+** mappings are not locked: an unprivileged RLIMIT_MEMLOCK would otherwise
+** turn later allocations into failures.
+*/
+void	rt_lock_memory(t_data *data)
+{
+	if (!data->opts.rt)
+		return ;
+	if (mlockall(MCL_CURRENT) != 0)
+		fprintf(stderr, "rt: mlockall failed (%s), memory not locked\n",
+			strerror(errno));
+}
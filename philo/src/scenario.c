@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenario.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:52:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	lerp(int from, int to, long long done, long long span)
+{
+	return (from + (to - from) * done / span);
+}
+
+/*
+** The values the current phase calls for at now ms into the run.
+*/
+static void	scenario_target(t_scenario *sc, long long now, t_timing *next)
+{
+	t_phase		*phase;
+	long long	span;
+
+	phase = &sc->phases[sc->current];
+	next->phase = sc->current;
+	next->die = phase->die;
+	next->eat = phase->eat;
+	next->sleep = phase->sleep;
+	next->slow_every = phase->slow_every;
+	next->slow_pct = phase->slow_pct;
+	if (!phase->ramp || sc->current == 0 || sc->current + 1 == sc->count)
+		return ;
+	span = phase[1].at_ms - phase->at_ms;
+	now -= phase->at_ms;
+	next->die = lerp(phase[-1].die, phase->die, now, span);
+	next->eat = lerp(phase[-1].eat, phase->eat, now, span);
+	next->sleep = lerp(phase[-1].sleep, phase->sleep, now, span);
+}
+
+/*
+** Seqlock write side. Besides the snapshot, the time_to_* fields follow
+** along for the code that reads them one at a time through live_die,
+** live_eat and live_sleep.
+*/
+static void	timing_publish(t_data *data, t_timing *next)
+{
+	t_scenario	*sc;
+
+	sc = data->scenario;
+	__atomic_store_n(&sc->seq, sc->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	timing_copy(&sc->live, next);
+	__atomic_store_n(&sc->seq, sc->seq + 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&data->time_to_die, next->die, __ATOMIC_RELAXED);
+	__atomic_store_n(&data->time_to_eat, next->eat, __ATOMIC_RELAXED);
+	__atomic_store_n(&data->time_to_sleep, next->sleep, __ATOMIC_RELAXED);
+}
+
+/*
+** Puts phase 0 in force before any thread exists.
+*/
+void	scenario_start(t_data *data)
+{
+	t_timing	first;
+
+	data->scenario->current = 0;
+	scenario_target(data->scenario, 0, &first);
+	timing_publish(data, &first);
+}
+
+/*
+** Called on every monitor pass: moves to the phase due now and publishes
+** the values only when they change.
+*/
+void	scenario_tick(t_data *data)
+{
+	t_scenario	*sc;
+	t_timing	next;
+	long long	now;
+
+	sc = data->scenario;
+	if (!sc)
+		return ;
+	now = get_time() - data->start_time;
+	while (sc->current + 1 < sc->count
+		&& sc->phases[sc->current + 1].at_ms <= now)
+		sc->current++;
+	scenario_target(sc, now, &next);
+	if (memcmp(&next, &sc->live, sizeof(t_timing)) != 0)
+		timing_publish(data, &next);
+}
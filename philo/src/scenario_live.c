@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenario_live.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:10:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** --scenario rewrites time_to_die, time_to_eat and time_to_sleep from the
+** monitor thread while the philosophers run, so every read that can
+** overlap a run goes through one of these relaxed loads.
+*/
+int	live_die(t_data *data)
+{
+	return (__atomic_load_n(&data->time_to_die, __ATOMIC_RELAXED));
+}
+
+int	live_eat(t_data *data)
+{
+	return (__atomic_load_n(&data->time_to_eat, __ATOMIC_RELAXED));
+}
+
+int	live_sleep(t_data *data)
+{
+	return (__atomic_load_n(&data->time_to_sleep, __ATOMIC_RELAXED));
+}
+
+/*
+** The timings in force now as the phase's slowed philosophers see them:
+** a floor for what the whole table can sustain, which is what the
+** watchdog must not mistake for a stall.
+*/
+void	timing_slowest(t_scenario *sc, t_timing *out)
+{
+	timing_read(sc, out);
+	if (!out->slow_every)
+		return ;
+	out->eat += out->eat * out->slow_pct / 100;
+	out->sleep += out->sleep * out->slow_pct / 100;
+}
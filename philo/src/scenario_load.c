@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenario_load.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:52:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:46:30 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	parse_phase(char *line, t_phase *phase)
+{
+	char	*save;
+	char	*token;
+	int		used;
+
+	memset(phase, 0, sizeof(t_phase));
+	if (sscanf(line, "%lld %d %d %d%n", &phase->at_ms, &phase->die,
+			&phase->eat, &phase->sleep, &used) != 4)
+		return (1);
+	token = strtok_r(line + used, " \t\r\n", &save);
+	while (token && *token != '#')
+	{
+		if (ft_strncmp(token, "ramp", 5) == 0)
+			phase->ramp = 1;
+		else if (sscanf(token, "slow=%d:%d%n", &phase->slow_every,
+				&phase->slow_pct, &used) != 2 || token[used] != '\0'
+			|| phase->slow_every <= 0 || phase->slow_pct < 0)
+			return (1);
+		token = strtok_r(NULL, " \t\r\n", &save);
+	}
+	return (phase->at_ms < 0 || phase->die <= 0 || phase->eat <= 0
+		|| phase->sleep <= 0);
+}
+
+/*
+** A file phase at 0 ms replaces the command-line phase; every other phase
+** must start strictly after the one before it.
+*/
+static int	add_phase(t_scenario *sc, int first)
+{
+	t_phase	*phase;
+
+	phase = &sc->phases[sc->count];
+	if (first && phase->at_ms == 0)
+		return (sc->phases[0] = *phase, 0);
+	if (phase->at_ms <= sc->phases[sc->count - 1].at_ms)
+		return (1);
+	sc->count++;
+	return (0);
+}
+
+/*
+** Returns 0, or the number of the first line that is not a valid phase.
+*/
+static int	read_phases(t_scenario *sc, FILE *file)
+{
+	char	*line;
+	size_t	cap;
+	int		lineno;
+	int		parsed;
+
+	line = NULL;
+	cap = 0;
+	lineno = 0;
+	parsed = 0;
+	while (getline(&line, &cap, file) >= 0)
+	{
+		lineno++;
+		if (line[strspn(line, " \t\r\n")] == '\0' || line[0] == '#')
+			continue ;
+		if (sc->count == SCENARIO_MAX_PHASES
+			|| parse_phase(line, &sc->phases[sc->count]) != 0
+			|| add_phase(sc, parsed++ == 0) != 0)
+			return (free(line), lineno);
+	}
+	free(line);
+	return (0);
+}
+
+int	scenario_load(t_data *data)
+{
+	t_scenario	*sc;
+	FILE		*file;
+	int			lineno;
+
+	sc = calloc(1, sizeof(t_scenario));
+	data->scenario = sc;
+	file = fopen(data->opts.scenario, "r");
+	if (!sc || !file)
+	{
+		if (file)
+			fclose(file);
+		return (printf("%s %s\n", ERR_SCENARIO, data->opts.scenario), 1);
+	}
+	sc->phases[0].die = data->time_to_die;
+	sc->phases[0].eat = data->time_to_eat;
+	sc->phases[0].sleep = data->time_to_sleep;
+	sc->count = 1;
+	lineno = read_phases(sc, file);
+	fclose(file);
+	if (lineno)
+		return (printf("%s %d\n", ERR_SCENARIO_LINE, lineno), 1);
+	scenario_start(data);
+	return (0);
+}
+
+void	scenario_free(t_data *data)
+{
+	free(data->scenario);
+	data->scenario = NULL;
+}
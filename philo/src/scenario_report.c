@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenario_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:52:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 19:52:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Counts a meal, and the fork wait before it, against the phase in force.
+*/
+void	scenario_meal(t_philo *philo, long long waited)
+{
+	t_scenario	*sc;
+	t_phase		*phase;
+
+	sc = philo->data->scenario;
+	if (!sc)
+		return ;
+	phase = &sc->phases[__atomic_load_n(&sc->live.phase, __ATOMIC_RELAXED)];
+	__atomic_add_fetch(&phase->meals, 1, __ATOMIC_RELAXED);
+	lat_record(&phase->wait, waited);
+}
+
+static void	print_phase(t_scenario *sc, int index, long long end)
+{
+	t_phase		*phase;
+	long long	span;
+	char		slow[24];
+	char		*ramp;
+
+	phase = &sc->phases[index];
+	if (index + 1 < sc->count && sc->phases[index + 1].at_ms < end)
+		end = sc->phases[index + 1].at_ms;
+	span = end - phase->at_ms;
+	ramp = "-";
+	if (phase->ramp)
+		ramp = "ramp";
+	snprintf(slow, sizeof(slow), "-");
+	if (phase->slow_every)
+		snprintf(slow, sizeof(slow), "%d:%d", phase->slow_every,
+			phase->slow_pct);
+	fprintf(stderr, "  %5d %8lld %5d %5d %5d %4s %-7s", index, phase->at_ms,
+		phase->die, phase->eat, phase->sleep, ramp, slow);
+	if (span <= 0)
+		fprintf(stderr, " not reached\n");
+	else
+		fprintf(stderr, "%7lld %8.1f %7.2f %7.2f %7.2f\n", phase->meals,
+			phase->meals * 1000.0 / span, lat_quantile(&phase->wait, 0.50)
+			/ 1000.0, lat_quantile(&phase->wait, 0.99) / 1000.0,
+			phase->wait.max / 1000.0);
+}
+
+/*
+** --scenario exit report on stderr: per phase, throughput over the part of
+** the phase the run reached, and the fork wait before each meal (ms).
+*/
+void	report_scenario(t_data *data)
+{
+	t_scenario	*sc;
+	long long	end;
+	int			i;
+
+	sc = data->scenario;
+	if (!sc)
+		return ;
+	end = data->end_time;
+	if (!end)
+		end = get_time();
+	end -= data->start_time;
+	fprintf(stderr, "scenario: %d phases, %s forks, run ended in phase %d "
+		"at %lldms\n", sc->count, FORK_LOCK_NAME, sc->current, end);
+	fprintf(stderr, "  phase    start   die   eat sleep ramp slow     meals"
+		"  meals/s  wait50  wait99 waitmax\n");
+	i = -1;
+	while (++i < sc->count)
+		print_phase(sc, i, end);
+}
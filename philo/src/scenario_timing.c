@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scenario_timing.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 19:52:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:10:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Word-by-word copy with relaxed atomics, so neither side of the seqlock
+** ever races on a plain access.
+*/
+void	timing_copy(t_timing *dst, t_timing *src)
+{
+	int		*to;
+	int		*from;
+	size_t	i;
+
+	to = (int *)dst;
+	from = (int *)src;
+	i = 0;
+	while (i < sizeof(t_timing) / sizeof(int))
+	{
+		__atomic_store_n(&to[i], __atomic_load_n(&from[i], __ATOMIC_RELAXED),
+			__ATOMIC_RELAXED);
+		i++;
+	}
+}
+
+void	timing_read(t_scenario *sc, t_timing *out)
+{
+	unsigned int	seq;
+
+	while (1)
+	{
+		seq = __atomic_load_n(&sc->seq, __ATOMIC_ACQUIRE);
+		timing_copy(out, &sc->live);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (!(seq & 1) && seq == __atomic_load_n(&sc->seq, __ATOMIC_RELAXED))
+			return ;
+	}
+}
+
+static int	slowed(t_philo *philo, t_timing *timing, int ms)
+{
+	if (timing->slow_every && philo->id % timing->slow_every == 0)
+		return (ms + ms * timing->slow_pct / 100);
+	return (ms);
+}
+
+/*
+** How long this philosopher's next meal lasts. A change published during a
+** meal applies from the next one.
+*/
+int	timing_eat(t_philo *philo)
+{
+	t_timing	timing;
+
+	if (!philo->data->scenario)
+		return (philo->data->time_to_eat);
+	timing_read(philo->data->scenario, &timing);
+	return (slowed(philo, &timing, timing.eat));
+}
+
+int	timing_sleep(t_philo *philo)
+{
+	t_timing	timing;
+
+	if (!philo->data->scenario)
+		return (philo->data->time_to_sleep);
+	timing_read(philo->data->scenario, &timing);
+	return (slowed(philo, &timing, timing.sleep));
+}
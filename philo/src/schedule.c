@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   schedule.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:47:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:08:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Periodic schedule for the ring, computed once at start-up.
+** k = floor(N/2) philosophers can eat at once. The period T is split into
+** N slots of T/N and philosopher i starts eating at slot (i * k) mod N.
+** Neighbours are then exactly k slots = k*T/N apart, including across
+** the wrap, so choosing k*T/N >= eat + guard means their meals never
+** overlap and forks are never contended. T must also leave each
+** philosopher time to eat and sleep before its own next slot.
+*/
+static long long	sched_period(t_data *data, int slots)
+{
+	long long	meal;
+	long long	period;
+
+	meal = data->time_to_eat * 1000LL + SCHED_GUARD_US;
+	period = (data->num_philos * meal + slots - 1) / slots;
+	if (period < meal + data->time_to_sleep * 1000LL)
+		period = meal + data->time_to_sleep * 1000LL;
+	return (period);
+}
+
+int	sched_compile(t_data *data)
+{
+	long long	period;
+	int			slots;
+	int			i;
+
+	slots = data->num_philos / 2;
+	if (data->res_index)
+		return (fprintf(stderr, "schedule: --topology is not a ring, "
+				"using the dynamic protocol\n"), 1);
+	if (slots == 0)
+		return (1);
+	period = sched_period(data, slots);
+	if (period + SCHED_SLACK_MS * 1000LL > data->time_to_die * 1000LL)
+		return (fprintf(stderr, "schedule: period %.1f ms does not fit "
+				"time_to_die, using the dynamic protocol\n", period / 1000.0),
+			1);
+	i = 0;
+	while (i < data->num_philos)
+	{
+		data->philos[i].sched_offset = ((long long)i * slots
+				% data->num_philos) * period / data->num_philos;
+		i++;
+	}
+	data->sched_period = period;
+	data->sched_slots = slots;
+	return (0);
+}
+
+void	sched_slip(t_data *data, long long late_us)
+{
+	pthread_mutex_lock(&data->death);
+	if (!data->sched_slipped)
+	{
+		data->sched_slipped = 1;
+		data->sched_slip_time = time_elapsed(data->start_time);
+		data->sched_slip_late = late_us;
+	}
+	pthread_mutex_unlock(&data->death);
+}
+
+int	sched_slipped(t_data *data)
+{
+	int	slipped;
+
+	pthread_mutex_lock(&data->death);
+	slipped = data->sched_slipped;
+	pthread_mutex_unlock(&data->death);
+	return (slipped);
+}
+
+void	report_schedule(t_data *data)
+{
+	double	planned;
+	double	achieved;
+	double	ideal;
+
+	if (!data->sched_period)
+		return ;
+	planned = (double)data->num_philos * data->time_to_eat * 1000
+		/ (data->sched_period * data->sched_slots);
+	achieved = run_meals(data) * 1000.0 / run_time(data);
+	ideal = ring_rate(data);
+	fprintf(stderr, "schedule: period %.3f ms, %d eating slots, planned "
+		"utilization %.1f%%\nthroughput %.2f meals/s, theoretical maximum "
+		"%.2f meals/s (%.1f%%)\n", data->sched_period / 1000.0,
+		data->sched_slots, 100.0 * planned, achieved, ideal,
+		100.0 * achieved / ideal);
+	if (data->sched_slipped)
+		fprintf(stderr, "schedule: slipped at %lld ms (%.3f ms late), "
+			"continued on the dynamic protocol\n", data->sched_slip_time,
+			data->sched_slip_late / 1000.0);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   schedule_run.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:47:03 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:36:42 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Called with both forks locked. A busy fork is noted as the one waited
+** on, so the grant after its release counts as a --latency handoff.
+*/
+static int	claim_forks(t_philo *philo, t_fork *first, t_fork *second)
+{
+	t_fork	*forks;
+
+	forks = philo->data->forks;
+	if (second->state != FORK_AVAILABLE)
+		philo->blocked_fork = second - forks;
+	if (first->state != FORK_AVAILABLE)
+		philo->blocked_fork = first - forks;
+	if (first->state != FORK_AVAILABLE || second->state != FORK_AVAILABLE)
+		return (0);
+	lat_handoff(philo, first - forks);
+	lat_handoff(philo, second - forks);
+	first->state = FORK_IN_USE;
+	first->owner_id = philo->id;
+	second->state = FORK_IN_USE;
+	second->owner_id = philo->id;
+	return (1);
+}
+
+/*
+** Both forks are checked together under their locks, taken in index order
+** and released in reverse, and only a claimed pair is announced: a retry
+** never prints a fork that is then put back.
+*/
+static int	assert_forks(t_philo *philo)
+{
+	t_fork	*first;
+	t_fork	*second;
+	int		is_free;
+
+	first = &philo->data->forks[philo->left_fork];
+	second = &philo->data->forks[philo->right_fork];
+	if (philo->left_fork > philo->right_fork)
+	{
+		first = &philo->data->forks[philo->right_fork];
+		second = &philo->data->forks[philo->left_fork];
+	}
+	fork_lock_acquire(&first->lock);
+	fork_lock_acquire(&second->lock);
+	is_free = claim_forks(philo, first, second);
+	fork_lock_release(&second->lock);
+	fork_lock_release(&first->lock);
+	if (is_free)
+	{
+		print_status(philo, MSG_FORK);
+		print_status(philo, MSG_FORK);
+	}
+	return (is_free);
+}
+
+/*
+** Forks are only asserted: by construction both are free at the slot, so
+** this never queues behind a neighbour. A fork still busy once the slot's
+** tolerance has passed means the schedule has slipped.
+*/
+static int	claim_slot(t_philo *philo, long long slot)
+{
+	while (!assert_forks(philo))
+	{
+		if (get_time_us() - slot > SCHED_TOLERANCE_US)
+			return (0);
+		usleep(50);
+		acct_wakeup();
+	}
+	return (1);
+}
+
+static void	scheduled_meal(t_philo *philo)
+{
+	grant_commit(philo);
+	pthread_mutex_lock(&philo->data->death);
+	philo->state = PHILO_EATING;
+	pthread_mutex_unlock(&philo->data->death);
+	print_status(philo, MSG_EAT);
+	record_meal_start(philo);
+	ft_usleep(live_eat(philo->data));
+	record_meal_end(philo);
+	release_both_forks(philo, 0, 0);
+	philo_sleep(philo);
+	if (check_death(philo))
+		return ;
+	pthread_mutex_lock(&philo->data->death);
+	philo->state = PHILO_THINKING;
+	pthread_mutex_unlock(&philo->data->death);
+	print_status(philo, MSG_THINK);
+}
+
+/*
+** Time-triggered executor: meal m starts at start + offset + m * period.
+** Returns as soon as any philosopher has slipped (a fork still busy past
+** the tolerance), leaving the caller to continue dynamically.
+*/
+void	run_schedule(t_philo *philo)
+{
+	t_data		*data;
+	long long	slot;
+	long long	late;
+
+	data = philo->data;
+	slot = data->start_us + SCHED_SLACK_MS * 1000LL + philo->sched_offset;
+	while (get_simulation_state(data) == SIM_RUNNING && !sched_slipped(data))
+	{
+		sleep_until_us(slot);
+		if (!claim_slot(philo, slot))
+		{
+			late = get_time_us() - slot;
+			sched_slip(data, late);
+			return ;
+		}
+		stats_wait_end(philo);
+		scheduled_meal(philo);
+		slot += data->sched_period;
+	}
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:24:03 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static size_t	shard_size(t_data *data)
+{
+	return (sizeof(t_data) + sizeof(t_shard)
+		+ sizeof(t_fork) * data->num_forks
+		+ sizeof(t_philo) * data->num_philos
+		+ sizeof(pid_t) * data->opts.procs);
+}
+
+static int	share_locks(t_data *data)
+{
+	int	i;
+
+	if (share_mutex(&data->print) || share_mutex(&data->death)
+		|| share_mutex(&data->start_lock) || share_mutex(&data->meal_lock))
+		return (1);
+	i = 0;
+	while (i < data->num_forks)
+		if (fork_lock_share(&data->forks[i++].lock) != 0)
+			return (1);
+	i = 0;
+	while (i < data->num_philos)
+		data->philos[i++].data = data;
+	return (0);
+}
+
+static void	release_local(t_data *local)
+{
+	cleanup_forks(local->forks, local->num_forks);
+	free(local->philos);
+	local->forks = NULL;
+	local->philos = NULL;
+	cleanup_single_mutex(&local->print);
+	cleanup_single_mutex(&local->death);
+	cleanup_single_mutex(&local->start_lock);
+	cleanup_single_mutex(&local->meal_lock);
+}
+
+/*
+** Moves the table into one anonymous shared mapping laid out as data,
+** shard, forks, philosophers and worker pids, and re-creates every lock as
+** process-shared. On success the local copy gives up its arrays and locks;
+** everything else it owned now belongs to the shared copy.
+*/
+t_data	*shard_share(t_data *local)
+{
+	t_data	*data;
+
+	data = mmap(NULL, shard_size(local), PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (data == MAP_FAILED)
+		return (NULL);
+	memcpy(data, local, sizeof(t_data));
+	data->shard = (t_shard *)(data + 1);
+	data->forks = (t_fork *)(data->shard + 1);
+	data->philos = (t_philo *)(data->forks + data->num_forks);
+	data->shard->pids = (pid_t *)(data->philos + data->num_philos);
+	data->shard->size = shard_size(local);
+	data->shard->procs = local->opts.procs;
+	data->shard->coordinator = getpid();
+	memcpy(data->forks, local->forks, sizeof(t_fork) * data->num_forks);
+	memcpy(data->philos, local->philos, sizeof(t_philo) * data->num_philos);
+	if (share_locks(data) != 0)
+		return (munmap(data, shard_size(local)), NULL);
+	release_local(local);
+	return (data);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_log.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Called with the shared print mutex held, so producers are serialized and
+** head has a single writer. On a full ring the coordinator drains it
+** itself; a worker waits with the mutex released, because the coordinator
+** may need it to report a death before it drains again.
+*/
+void	shard_push(t_data *data, long long time, int id, char *status)
+{
+	t_shard			*shard;
+	t_log_entry		*entry;
+
+	shard = data->shard;
+	while (shard->head - __atomic_load_n(&shard->tail, __ATOMIC_ACQUIRE)
+		>= SHARD_LOG)
+	{
+		if (getpid() == shard->coordinator)
+		{
+			shard_drain(data);
+			continue ;
+		}
+		pthread_mutex_unlock(&data->print);
+		usleep(50);
+		acct_wakeup();
+		pthread_mutex_lock(&data->print);
+	}
+	entry = &shard->log[shard->head % SHARD_LOG];
+	entry->time = time;
+	entry->id = id;
+	entry->status = status;
+	__atomic_store_n(&shard->head, shard->head + 1, __ATOMIC_RELEASE);
+}
+
+/*
+** Prints every published line in ring order. Only the coordinator calls
+** this, from one thread at a time, so tail has a single writer.
+*/
+void	shard_drain(t_data *data)
+{
+	t_shard			*shard;
+	t_log_entry		*entry;
+	unsigned long	tail;
+	unsigned long	head;
+
+	shard = data->shard;
+	if (!shard)
+		return ;
+	tail = shard->tail;
+	head = __atomic_load_n(&shard->head, __ATOMIC_ACQUIRE);
+	while (tail != head)
+	{
+		entry = &shard->log[tail % SHARD_LOG];
+		if (data->out)
+			fprintf(data->out, "%lld %d %s\n", entry->time, entry->id,
+				entry->status);
+		tail++;
+	}
+	__atomic_store_n(&shard->tail, tail, __ATOMIC_RELEASE);
+}
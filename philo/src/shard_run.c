@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_run.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Reports this worker's launch to the coordinator, locking its memory
+** first under --rt so the table is never released into page faults.
+*/
+static void	worker_ready(t_data *data, int failed)
+{
+	if (failed)
+	{
+		fprintf(stderr, "%s\n", ERR_CREATE_THREAD);
+		set_simulation_state(data, SIM_ERROR);
+	}
+	rt_lock_memory(data);
+	__atomic_add_fetch(&data->shard->ready, 1, __ATOMIC_RELEASE);
+}
+
+/*
+** Worker body: starts philosophers [first, last), which block on the
+** shared start_lock until the coordinator releases the whole table.
+** Workers die with the coordinator, since without its monitor nobody would
+** stop their philosophers. _exit skips the inherited stdio buffers.
+*/
+static void	worker_main(t_data *data, int first, int last)
+{
+	int	failed;
+	int	i;
+
+#ifdef __linux__
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+	failed = 0;
+	i = first;
+	while (i < last && !failed)
+	{
+		data->philos[i].last_eat_time = get_time();
+		if (thread_start(&data->philos[i].thread, philo_routine,
+				&data->philos[i], data->opts.rt * RT_PRIO_PHILO) != 0)
+			failed = 1;
+		else
+			i++;
+	}
+	worker_ready(data, failed);
+	while (i-- > first)
+		pthread_join(data->philos[i].thread, NULL);
+	__atomic_add_fetch(&data->shard->jitter_injected,
+		jitter_config()->injected, __ATOMIC_RELAXED);
+	_exit(failed);
+}
+
+/*
+** Forks one worker per contiguous range of philosophers, then waits until
+** each has created its threads or is gone.
+*/
+static int	spawn_workers(t_data *data)
+{
+	t_shard	*shard;
+	pid_t	pid;
+	int		i;
+
+	shard = data->shard;
+	i = 0;
+	while (i < shard->procs)
+	{
+		pid = fork();
+		if (pid == 0)
+			worker_main(data, (long long)i * data->num_philos / shard->procs,
+				(long long)(i + 1) * data->num_philos / shard->procs);
+		if (pid < 0)
+			return (printf("%s\n", ERR_PROCS),
+				set_simulation_state(data, SIM_ERROR), 1);
+		shard->pids[i++] = pid;
+		shard->alive++;
+	}
+	while (__atomic_load_n(&shard->ready, __ATOMIC_ACQUIRE) < shard->alive)
+	{
+		shard_poll(data);
+		usleep(100);
+		acct_wakeup();
+	}
+	return (0);
+}
+
+static int	shard_launch(t_data *data)
+{
+	int	failed;
+
+	data->start_time = get_time();
+	data->start_us = get_time_us();
+	stats_start(data);
+	pthread_mutex_lock(&data->start_lock);
+	failed = spawn_workers(data);
+	if (!failed && thread_start(&data->monitor_thread, monitor_routine,
+			data, data->opts.rt * RT_PRIO_MONITOR) != 0)
+	{
+		printf("%s\n", ERR_CREATE_MONITOR);
+		set_simulation_state(data, SIM_ERROR);
+		failed = 1;
+	}
+	data->monitor_started = !failed;
+	rt_lock_memory(data);
+	pthread_mutex_unlock(&data->start_lock);
+	return (failed);
+}
+
+/*
+** --procs=P: the coordinator keeps the monitor and the output, and P
+** worker processes run the philosophers on the shared table. Grant logs
+** stay in each worker, so --record is not available here.
+*/
+int	run_procs(t_data *local)
+{
+	t_data	*data;
+	int		failed;
+
+	if (local->opts.procs > local->num_philos || local->opts.record)
+		return (printf("%s\n", ERR_PROCS), free_resources(local), 1);
+	data = shard_share(local);
+	if (!data)
+		return (printf("%s\n", ERR_PROCS), free_resources(local), 1);
+	failed = shard_launch(data);
+	handle_termination(data);
+	shard_wait(data);
+	acct_finish(data, &data->shard->coordinator_acct);
+	jitter_config()->injected += data->shard->jitter_injected;
+	report_run(data);
+	if (is_state(data, SIM_ERROR))
+		failed = 1;
+	shard_close(data);
+	prof_report();
+	return (failed);
+}
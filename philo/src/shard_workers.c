@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_workers.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:24:51 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static void	lost_worker(t_data *data, int worker, int status)
+{
+	long long	first;
+	long long	last;
+
+	first = (long long)worker * data->num_philos / data->shard->procs;
+	last = (long long)(worker + 1) * data->num_philos / data->shard->procs;
+	if (WIFSIGNALED(status))
+		fprintf(stderr, "%s: worker %d (philosophers %lld-%lld) killed by "
+			"signal %d\n", ERR_WORKER, worker + 1, first + 1, last,
+			WTERMSIG(status));
+	else
+		fprintf(stderr, "%s: worker %d (philosophers %lld-%lld) exited "
+			"with status %d\n", ERR_WORKER, worker + 1, first + 1, last,
+			WEXITSTATUS(status));
+	set_simulation_state(data, SIM_ERROR);
+}
+
+/*
+** Workers only exit after the simulation has stopped, so any worker that
+** goes away while it is still running has crashed and ends the run.
+*/
+static int	reap(t_data *data, int options)
+{
+	t_shard	*shard;
+	pid_t	pid;
+	int		status;
+	int		i;
+
+	shard = data->shard;
+	pid = waitpid(-1, &status, options);
+	if (pid <= 0)
+		return (0);
+	i = 0;
+	while (i < shard->procs && shard->pids[i] != pid)
+		i++;
+	if (i == shard->procs)
+		return (1);
+	shard->pids[i] = 0;
+	shard->alive--;
+	if (is_state(data, SIM_RUNNING))
+		lost_worker(data, i, status);
+	return (1);
+}
+
+void	shard_poll(t_data *data)
+{
+	if (!data->shard)
+		return ;
+	shard_drain(data);
+	while (reap(data, WNOHANG))
+		shard_drain(data);
+}
+
+/*
+** Reaps every worker once the monitor is done. A worker stuck on a lock
+** its crashed neighbour held is killed after the grace period.
+*/
+void	shard_wait(t_data *data)
+{
+	long long	deadline;
+	int			i;
+
+	deadline = get_time() + data->time_to_die + SHARD_GRACE_MS;
+	while (data->shard->alive > 0)
+	{
+		shard_drain(data);
+		if (reap(data, WNOHANG))
+			continue ;
+		i = 0;
+		while (get_time() > deadline && i < data->shard->procs)
+		{
+			if (data->shard->pids[i])
+				kill(data->shard->pids[i], SIGKILL);
+			i++;
+		}
+		usleep(1000);
+		acct_wakeup();
+	}
+	shard_drain(data);
+}
+
+void	shard_close(t_data *data)
+{
+	size_t	size;
+	int		i;
+
+	size = data->shard->size;
+	free_grants(data);
+	i = 0;
+	while (i < data->num_forks)
+		fork_lock_destroy(&data->forks[i++].lock);
+	data->forks = NULL;
+	data->philos = NULL;
+	free_resources(data);
+	munmap(data, size);
+}
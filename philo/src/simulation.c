@@ -6,7 +6,7 @@
 /*   By: snakajim <snakajim@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:36:36 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/12 15:38:57 by snakajim         ###   ########.fr       */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,32 +24,39 @@ int	get_simulation_state(t_data *data)
 
 int	set_simulation_state(t_data *data, int state)
 {
+	long long	meals;
+
+	meals = 0;
+	if (state != SIM_RUNNING && data->philos)
+		meals = total_meals(data);
 	pthread_mutex_lock(&data->death);
 	data->sim_state = state;
+	if (state != SIM_RUNNING && data->end_time == 0)
+	{
+		data->end_time = get_time();
+		data->end_meals = meals;
+	}
 	if (state == SIM_STOPPED)
 		data->is_dead = 1;
 	pthread_mutex_unlock(&data->death);
+	stats_set_state(data, state, -1);
 	return (0);
 }
 
 void	handle_termination(t_data *data)
 {
-	int	i;
-
-	pthread_join(data->monitor_thread, NULL);
-	i = 0;
-	while (i < data->num_philos)
-	{
-		pthread_join(data->philos[i].thread, NULL);
-		i++;
-	}
+	if (data->monitor_started)
+		pthread_join(data->monitor_thread, NULL);
+	join_philosophers(data);
 }
 
 void	handle_meal_completion(t_data *data)
 {
 	pthread_mutex_lock(&data->print);
-	printf("%lld All philosophers have eaten enough\n",
-		time_elapsed(data->start_time));
+	shard_drain(data);
+	if (data->out)
+		fprintf(data->out, "%lld All philosophers have eaten enough\n",
+			time_elapsed(data->start_time));
 	pthread_mutex_unlock(&data->print);
 	set_simulation_state(data, SIM_COMPLETED);
 }
@@ -64,12 +71,14 @@ int	try_get_forks(t_philo *philo)
 	while (!check_death(philo)
 		&& get_simulation_state(philo->data) == SIM_RUNNING)
 	{
-		if (can_take_fork(philo, philo->left_fork) && can_take_fork(philo,
-				philo->right_fork))
+		if (philo->res && resources_available(philo))
+			return (1);
+		if (!philo->res && can_take_fork(philo, philo->left_fork)
+			&& can_take_fork(philo, philo->right_fork))
 			return (1);
 		if (++attempts > max_attempts)
 		{
-			ft_usleep(philo->data->time_to_eat / 10);
+			ft_usleep(live_eat(philo->data) / 10);
 			attempts = 0;
 		}
 		else
@@ -0,0 +1,83 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static size_t	stats_size(t_data *data)
+{
+	return (sizeof(t_shm_stats) + sizeof(t_shm_philo) * data->num_philos);
+}
+
+int	stats_open(t_data *data)
+{
+	int	fd;
+
+	snprintf(data->shm_name, SHM_NAME_LEN, SHM_NAME_FMT, (int)getpid());
+	fd = shm_open(data->shm_name, O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0)
+		return (1);
+	if (ftruncate(fd, stats_size(data)) != 0)
+		return (close(fd), shm_unlink(data->shm_name), 1);
+	data->shm = mmap(NULL, stats_size(data), PROT_READ | PROT_WRITE,
+			MAP_SHARED, fd, 0);
+	close(fd);
+	if (data->shm == MAP_FAILED)
+		return (data->shm = NULL, shm_unlink(data->shm_name), 1);
+	memset(data->shm, 0, stats_size(data));
+	data->shm->num_philos = data->num_philos;
+	data->shm->time_to_die = data->time_to_die;
+	data->shm->dead_id = -1;
+	fprintf(stderr, "philo: live stats at %s\n", data->shm_name);
+	return (0);
+}
+
+void	stats_start(t_data *data)
+{
+	if (!data->shm)
+		return ;
+	data->shm->start_time = data->start_time;
+	__atomic_store_n(&data->shm->sim_state, SIM_RUNNING, __ATOMIC_RELAXED);
+	__atomic_store_n(&data->shm->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+}
+
+void	stats_close(t_data *data)
+{
+	if (!data->shm)
+		return ;
+	munmap(data->shm, stats_size(data));
+	shm_unlink(data->shm_name);
+	data->shm = NULL;
+}
+
+/*
+** Seqlock write of the philosopher's own slot. Only the owning thread ever
+** writes here, so bumping seq needs no read-modify-write.
+*/
+void	stats_publish(t_philo *philo, int state)
+{
+	t_shm_philo		*slot;
+	unsigned int	seq;
+
+	if (!philo->data->shm)
+		return ;
+	slot = &philo->data->shm->philos[philo->id - 1];
+	seq = slot->seq;
+	__atomic_store_n(&slot->seq, seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	__atomic_store_n(&slot->state, state, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->eat_count, philo->eat_count, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->last_eat_time, philo->last_eat_time,
+		__ATOMIC_RELAXED);
+	__atomic_store_n(&slot->wait_total, philo->wait_total, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->wait_start, philo->wait_start, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->seq, seq + 2, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stats_events.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:13:20 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	stats_add(t_data *data, int counter)
+{
+	if (!data->shm)
+		return ;
+	__atomic_fetch_add(&data->shm->counters[counter], 1, __ATOMIC_RELAXED);
+}
+
+void	stats_set_state(t_data *data, int state, int dead_id)
+{
+	if (!data->shm)
+		return ;
+	if (dead_id >= 0)
+		__atomic_store_n(&data->shm->dead_id, dead_id, __ATOMIC_RELAXED);
+	__atomic_store_n(&data->shm->sim_state, state, __ATOMIC_RELEASE);
+}
+
+void	stats_wait_begin(t_philo *philo)
+{
+	if (philo->wait_start)
+		return ;
+	philo->wait_start = get_time_us();
+	stats_publish(philo, PHILO_THINKING);
+}
+
+/*
+** Closes the open fork wait and returns its length in microseconds, or 0
+** when none was open.
+*/
+long long	stats_wait_end(t_philo *philo)
+{
+	long long	waited;
+
+	if (!philo->wait_start)
+		return (0);
+	waited = get_time_us() - philo->wait_start;
+	philo->wait_total += waited;
+	philo->wait_start = 0;
+	return (waited);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tables.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:35:02 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** One monitor thread serves every table: each pass ticks all tables that
+** are still running, then sleeps once, instead of one polling loop per
+** table competing for the same cores. Like monitor_routine it sleeps
+** without jitter.
+*/
+static void	*tables_monitor(void *arg)
+{
+	t_table_set	*set;
+	int			active;
+	int			i;
+
+	set = (t_table_set *)arg;
+	rt_prefault(&set->tables[0]);
+	active = 1;
+	while (active)
+	{
+		active = 0;
+		i = 0;
+		while (i < set->count)
+		{
+			if (monitor_tick(&set->tables[i]))
+				active = 1;
+			i++;
+		}
+		if (active)
+			sleep_until_us(get_time_us() + MONITOR_PERIOD_US);
+	}
+	return (NULL);
+}
+
+static int	start_tables(t_table_set *set)
+{
+	int	failed;
+	int	i;
+
+	failed = 0;
+	i = 0;
+	while (i < set->count)
+	{
+		if (start_philosophers(&set->tables[i]) != 0)
+		{
+			set_simulation_state(&set->tables[i], SIM_ERROR);
+			failed = 1;
+		}
+		i++;
+	}
+	return (failed);
+}
+
+/*
+** Starts every table before releasing any of them, so all tables share one
+** start instant and one monitor thread for their whole lifetime. Tables
+** copy the global options, so the first one carries --rt for the monitor.
+*/
+int	run_table_set(t_table_set *set)
+{
+	pthread_t	monitor;
+	int			failed;
+	int			created;
+	int			i;
+
+	failed = start_tables(set);
+	created = (thread_start(&monitor, tables_monitor, set,
+				set->tables[0].opts.rt * RT_PRIO_MONITOR) == 0);
+	rt_lock_memory(&set->tables[0]);
+	i = -1;
+	while (++i < set->count)
+	{
+		if (!created)
+			set_simulation_state(&set->tables[i], SIM_ERROR);
+		pthread_mutex_unlock(&set->tables[i].start_lock);
+	}
+	if (created)
+		pthread_join(monitor, NULL);
+	i = -1;
+	while (++i < set->count)
+		join_philosophers(&set->tables[i]);
+	return (failed || !created);
+}
+
+void	free_table_set(t_table_set *set)
+{
+	int	i;
+
+	i = 0;
+	while (set->tables && i < set->count)
+		free_resources(&set->tables[i++]);
+	free(set->tables);
+	set->tables = NULL;
+	set->count = 0;
+}
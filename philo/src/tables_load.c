@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tables_load.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 16:24:51 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	is_blank(char *line)
+{
+	while (*line == ' ' || (*line >= 9 && *line <= 13))
+		line++;
+	return (*line == '\0' || *line == '#');
+}
+
+static int	split_line(char *line, char **args)
+{
+	int		argc;
+	char	*save;
+	char	*token;
+
+	args[0] = "philo";
+	argc = 1;
+	token = strtok_r(line, " \t\r\n", &save);
+	while (token && argc < 7)
+	{
+		args[argc++] = token;
+		token = strtok_r(NULL, " \t\r\n", &save);
+	}
+	return (argc);
+}
+
+static int	init_table(t_table_set *set, t_opts *opts, char *line)
+{
+	t_data	*table;
+	char	*args[7];
+	char	name[4096];
+	int		argc;
+
+	table = &set->tables[set->count];
+	argc = split_line(line, args);
+	if (argc != 5 && argc != 6)
+		return (1);
+	table->opts = *opts;
+	table->opts.stats = 0;
+	table->opts.record = NULL;
+	table->opts.replay = NULL;
+	table->opts.topology = NULL;
+	table->opts.procs = 0;
+	if (init_data(table, argc, args) != 0)
+		return (1);
+	if (init_philos(table) != 0)
+		return (table->out = NULL, free_resources(table), 1);
+	snprintf(name, sizeof(name), "%s.%d.log", set->path, set->count + 1);
+	table->out = fopen(name, "w");
+	if (!table->out)
+		return (free_resources(table), 1);
+	set->count++;
+	return (0);
+}
+
+static int	count_tables(FILE *file)
+{
+	char	*line;
+	size_t	cap;
+	int		count;
+
+	line = NULL;
+	cap = 0;
+	count = 0;
+	while (getline(&line, &cap, file) >= 0)
+	{
+		if (!is_blank(line))
+			count++;
+	}
+	free(line);
+	rewind(file);
+	return (count);
+}
+
+/*
+** Every non-blank line of the file is "N die eat sleep [must_eat]" and
+** becomes its own t_data, validated exactly like the command line.
+*/
+int	load_tables(t_table_set *set, t_opts *opts)
+{
+	FILE	*file;
+	char	*line;
+	size_t	cap;
+	int		lineno;
+
+	file = fopen(set->path, "r");
+	if (!file)
+		return (printf("%s %s\n", ERR_TABLES, set->path), 1);
+	set->tables = calloc(count_tables(file) + 1, sizeof(t_data));
+	line = NULL;
+	cap = 0;
+	lineno = 0;
+	while (set->tables && getline(&line, &cap, file) >= 0)
+	{
+		lineno++;
+		if (!is_blank(line) && init_table(set, opts, line) != 0)
+			return (printf("%s %d\n", ERR_TABLE_LINE, lineno), free(line),
+				fclose(file), free_table_set(set), 1);
+	}
+	free(line);
+	fclose(file);
+	if (!set->tables || set->count == 0)
+		return (printf("%s %s\n", ERR_TABLES, set->path),
+			free_table_set(set), 1);
+	return (0);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tables_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:05:12 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:41:15 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static long long	report_table(t_data *table, int index, char *path)
+{
+	long long	meals;
+	long long	elapsed;
+
+	meals = run_meals(table);
+	elapsed = run_time(table);
+	printf("table %d: %d %d %d %d %d -> ", index + 1, table->num_philos,
+		table->time_to_die, table->time_to_eat, table->time_to_sleep,
+		table->must_eat);
+	if (table->dead_id)
+		printf("philosopher %d died", table->dead_id);
+	else if (table->sim_state == SIM_COMPLETED)
+		printf("completed");
+	else
+		printf("error");
+	printf(" at %lld ms, %lld meals (%.1f/s), log %s.%d.log\n", elapsed,
+		meals, meals * 1000.0 / elapsed, path, index + 1);
+	return (meals);
+}
+
+/*
+** Tables never run sched_compile or report_run, so options that only act
+** through them are refused rather than silently doing nothing.
+*/
+static int	tables_refused(t_opts *opts)
+{
+	char	*name;
+
+	name = NULL;
+	if (opts->schedule)
+		name = "--schedule";
+	else if (opts->watchdog)
+		name = "--watchdog";
+	else if (opts->fairness)
+		name = "--fairness";
+	else if (opts->latency)
+		name = "--latency";
+	else if (opts->accounting)
+		name = "--accounting";
+	if (!name)
+		return (0);
+	printf("%s %s\n", ERR_TABLES_MODE, name);
+	return (1);
+}
+
+int	run_tables(t_opts *opts)
+{
+	t_table_set	set;
+	long long	start;
+	long long	meals;
+	int			status;
+	int			i;
+
+	memset(&set, 0, sizeof(t_table_set));
+	set.path = opts->tables;
+	if (tables_refused(opts) || load_tables(&set, opts) != 0)
+		return (1);
+	start = get_time();
+	status = run_table_set(&set);
+	start = time_elapsed(start);
+	meals = 0;
+	i = -1;
+	while (++i < set.count)
+		meals += report_table(&set.tables[i], i, set.path);
+	if (start <= 0)
+		start = 1;
+	printf("%d tables, %lld meals in %lld ms (%.1f meals/s)\n", set.count,
+		meals, start, meals * 1000.0 / start);
+	free_table_set(&set);
+	prof_report();
+	return (status);
+}
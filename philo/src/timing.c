@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:39:28 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+long long	get_time_us(void)
+{
+	struct timespec	ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return (-1);
+	return ((ts.tv_sec * 1000000LL) + (ts.tv_nsec / 1000));
+}
+
+long long	get_time_ns(void)
+{
+	struct timespec	ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return (-1);
+	return ((ts.tv_sec * 1000000000LL) + ts.tv_nsec);
+}
+
+/*
+** Sleeps until an absolute CLOCK_MONOTONIC time in microseconds, with the
+** same shrinking slices as ft_usleep so the wake-up lands close to target.
+*/
+void	sleep_until_us(long long target)
+{
+	long long	remaining;
+
+	remaining = target - get_time_us();
+	while (remaining > 0)
+	{
+		if (remaining > 50000)
+			usleep(500);
+		else if (remaining > 10000)
+			usleep(200);
+		else if (remaining > 100)
+			usleep(remaining / 2);
+		else
+			usleep(50);
+		acct_wakeup();
+		remaining = target - get_time_us();
+	}
+}
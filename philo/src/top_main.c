@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_main.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:51:04 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+static int	top_attach(t_top *top, char *pid)
+{
+	char		name[SHM_NAME_LEN];
+	int			fd;
+	struct stat	st;
+
+	top->pid = ft_atoi(pid);
+	snprintf(name, SHM_NAME_LEN, SHM_NAME_FMT, (int)top->pid);
+	fd = shm_open(name, O_RDONLY, 0);
+	if (fd < 0)
+		return (1);
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(t_shm_stats))
+		return (close(fd), 1);
+	top->size = st.st_size;
+	top->shm = mmap(NULL, top->size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (top->shm == MAP_FAILED)
+		return (1);
+	return (0);
+}
+
+/*
+** Waits for the simulation to publish its segment, giving up once the
+** process that owns it is gone: a run that died before starting leaves
+** the segment behind without ever setting the magic.
+*/
+static int	top_prepare(t_top *top)
+{
+	int	n;
+
+	while (__atomic_load_n(&top->shm->magic, __ATOMIC_ACQUIRE) != SHM_MAGIC)
+	{
+		if (kill(top->pid, 0) != 0 && errno == ESRCH)
+			return (printf("philo-top: pid %d exited before starting\n",
+					(int)top->pid), 1);
+		usleep(10000);
+	}
+	n = top->shm->num_philos;
+	if (n <= 0 || top->size < sizeof(t_shm_stats) + sizeof(t_shm_philo) * n)
+		return (1);
+	top->rows = malloc(sizeof(t_top_row) * n);
+	top->order = malloc(sizeof(int) * n);
+	if (!top->rows || !top->order)
+		return (free(top->rows), free(top->order), 1);
+	return (0);
+}
+
+static int	top_run(t_top *top)
+{
+	int	running;
+
+	if (top_prepare(top) != 0)
+		return (munmap(top->shm, top->size), 1);
+	running = 1;
+	while (running)
+	{
+		running = (__atomic_load_n(&top->shm->sim_state, __ATOMIC_ACQUIRE)
+				== SIM_RUNNING);
+		top_snapshot(top);
+		top_render(top);
+		if (running)
+			usleep(top->interval * 1000);
+	}
+	free(top->rows);
+	free(top->order);
+	munmap(top->shm, top->size);
+	return (0);
+}
+
+int	main(int argc, char **argv)
+{
+	t_top	top;
+
+	if (argc < 2 || argc > 4)
+		return (printf("%s\n", TOP_USAGE), 1);
+	memset(&top, 0, sizeof(t_top));
+	top.interval = TOP_INTERVAL;
+	top.limit = TOP_ROWS;
+	if (argc >= 3)
+		top.interval = ft_atoi(argv[2]);
+	if (argc == 4)
+		top.limit = ft_atoi(argv[3]);
+	if (top.interval <= 0 || top.limit <= 0)
+		return (printf("%s\n", TOP_USAGE), 1);
+	if (top_attach(&top, argv[1]) != 0)
+		return (printf("philo-top: no stats segment for pid %s\n", argv[1]),
+			1);
+	return (top_run(&top));
+}
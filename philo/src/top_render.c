@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_render.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+static const char	*state_name(int state)
+{
+	if (state == PHILO_EATING)
+		return ("eating");
+	if (state == PHILO_SLEEPING)
+		return ("sleeping");
+	if (state == PHILO_DEAD)
+		return ("dead");
+	return ("thinking");
+}
+
+static const char	*sim_name(int state)
+{
+	if (state == SIM_RUNNING)
+		return ("running");
+	if (state == SIM_COMPLETED)
+		return ("completed");
+	if (state == SIM_ERROR)
+		return ("error");
+	return ("stopped");
+}
+
+static void	render_header(t_top *top)
+{
+	t_shm_stats	*shm;
+	long long	elapsed;
+	long long	meals;
+
+	shm = top->shm;
+	elapsed = get_time() - shm->start_time;
+	meals = __atomic_load_n(&shm->counters[STAT_MEALS], __ATOMIC_RELAXED);
+	if (elapsed <= 0)
+		elapsed = 1;
+	printf("philo-top  %d philosophers  %lld ms  %s", shm->num_philos,
+		elapsed, sim_name(__atomic_load_n(&shm->sim_state,
+				__ATOMIC_ACQUIRE)));
+	if (__atomic_load_n(&shm->dead_id, __ATOMIC_RELAXED) > 0)
+		printf("  (philosopher %d died)", shm->dead_id);
+	printf("\nmeals %lld (%.1f/s)  fork takes %lld  rollbacks %lld\n",
+		meals, meals * 1000.0 / elapsed,
+		__atomic_load_n(&shm->counters[STAT_FORK_TAKES], __ATOMIC_RELAXED),
+		__atomic_load_n(&shm->counters[STAT_ROLLBACKS], __ATOMIC_RELAXED));
+}
+
+static void	render_table(t_top *top, const char *title)
+{
+	t_top_row	*row;
+	int			i;
+
+	printf("\n%s\n%6s %-9s %6s %10s %10s %10s %12s\n", title, "id", "state",
+		"meals", "since_meal", "margin", "wait_now", "wait_total");
+	i = 0;
+	while (i < top->ranked)
+	{
+		row = &top->rows[top->order[i]];
+		printf("%6d %-9s %6d %10lld %10lld %10.1f %12.1f\n", row->id,
+			state_name(row->state), row->eat_count, row->since_meal,
+			top->shm->time_to_die - row->since_meal, row->wait_now / 1000.0,
+			row->wait_total / 1000.0);
+		i++;
+	}
+}
+
+void	top_render(t_top *top)
+{
+	printf("\033[H\033[2J");
+	render_header(top);
+	top_rank(top, TOP_BY_WAIT);
+	render_table(top, "Hottest waiters (ms)");
+	top_rank(top, TOP_BY_DEATH);
+	render_table(top, "Closest to death (ms)");
+	fflush(stdout);
+}
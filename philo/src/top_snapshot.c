@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   top_snapshot.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 09:12:40 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 09:12:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_top.h"
+
+/*
+** Seqlock read: copy the slot and retry if the writer was mid-update.
+** A bounded number of retries keeps a crashed writer from hanging the view.
+*/
+static void	read_slot(t_shm_philo *slot, t_shm_philo *out)
+{
+	unsigned int	seq;
+	int				tries;
+
+	tries = 0;
+	while (tries++ < 1000)
+	{
+		seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+		if (seq & 1)
+			continue ;
+		out->state = __atomic_load_n(&slot->state, __ATOMIC_RELAXED);
+		out->eat_count = __atomic_load_n(&slot->eat_count, __ATOMIC_RELAXED);
+		out->last_eat_time = __atomic_load_n(&slot->last_eat_time,
+				__ATOMIC_RELAXED);
+		out->wait_total = __atomic_load_n(&slot->wait_total,
+				__ATOMIC_RELAXED);
+		out->wait_start = __atomic_load_n(&slot->wait_start,
+				__ATOMIC_RELAXED);
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+		if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) == seq)
+			return ;
+	}
+}
+
+static void	fill_row(t_top *top, t_top_row *row, t_shm_philo *slot,
+		long long now_us)
+{
+	long long	last_meal;
+
+	last_meal = slot->last_eat_time;
+	if (last_meal == 0)
+		last_meal = top->shm->start_time;
+	row->state = slot->state;
+	row->eat_count = slot->eat_count;
+	row->since_meal = get_time() - last_meal;
+	row->wait_now = 0;
+	if (slot->wait_start)
+		row->wait_now = now_us - slot->wait_start;
+	row->wait_total = slot->wait_total + row->wait_now;
+}
+
+void	top_snapshot(t_top *top)
+{
+	t_shm_philo	slot;
+	long long	now_us;
+	int			i;
+
+	now_us = get_time_us();
+	i = 0;
+	while (i < top->shm->num_philos)
+	{
+		memset(&slot, 0, sizeof(t_shm_philo));
+		read_slot(&top->shm->philos[i], &slot);
+		top->rows[i].id = i + 1;
+		fill_row(top, &top->rows[i], &slot, now_us);
+		i++;
+	}
+}
+
+static int	row_above(t_top_row *a, t_top_row *b, int key)
+{
+	if (key == TOP_BY_DEATH)
+		return (a->since_meal > b->since_meal);
+	if (a->wait_now != b->wait_now)
+		return (a->wait_now > b->wait_now);
+	return (a->wait_total > b->wait_total);
+}
+
+/*
+** Partial insertion sort: keeps only the first `limit` rows in order,
+** so a refresh costs O(N * limit) instead of sorting every philosopher.
+*/
+void	top_rank(t_top *top, int key)
+{
+	int	i;
+	int	j;
+
+	top->ranked = 0;
+	i = 0;
+	while (i < top->shm->num_philos)
+	{
+		j = top->ranked;
+		if (j < top->limit)
+			top->ranked++;
+		while (j > 0 && row_above(&top->rows[i],
+				&top->rows[top->order[j - 1]], key))
+		{
+			if (j < top->limit)
+				top->order[j] = top->order[j - 1];
+			j--;
+		}
+		if (j < top->limit)
+			top->order[j] = i;
+		i++;
+	}
+}
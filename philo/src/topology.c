@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   topology.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:55:41 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 13:55:41 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+static int	sort_unique(int *res, int count)
+{
+	int	i;
+	int	j;
+	int	key;
+
+	i = 0;
+	while (++i < count)
+	{
+		key = res[i];
+		j = i - 1;
+		while (j >= 0 && res[j] > key)
+		{
+			res[j + 1] = res[j];
+			j--;
+		}
+		res[j + 1] = key;
+	}
+	j = 0;
+	i = 0;
+	while (++i < count)
+		if (res[i] != res[j])
+			res[++j] = res[i];
+	return (j + 1);
+}
+
+/*
+** Parses one philosopher's resource set and stores it sorted and without
+** duplicates: ascending index is the global acquisition order.
+*/
+static int	parse_set(t_data *data, char *line, int philo)
+{
+	char	*end;
+	long	value;
+	int		count;
+	int		*res;
+
+	res = data->res_list + data->res_index[philo];
+	count = 0;
+	value = strtol(line, &end, 10);
+	while (end != line)
+	{
+		if (value < 0 || value >= data->num_forks || count == TOPO_MAX_DEGREE)
+			return (1);
+		res[count++] = value;
+		line = end;
+		value = strtol(line, &end, 10);
+	}
+	if (count == 0 || (*end != '\0' && *end != '\n' && *end != '#'))
+		return (1);
+	data->res_index[philo + 1] = data->res_index[philo]
+		+ sort_unique(res, count);
+	return (0);
+}
+
+static int	read_sets(t_data *data, FILE *file)
+{
+	char	*line;
+	size_t	cap;
+	int		philo;
+	int		error;
+
+	line = NULL;
+	cap = 0;
+	philo = 0;
+	error = 0;
+	while (!error && getline(&line, &cap, file) >= 0)
+	{
+		if (line[strspn(line, " \t\r\n")] == '\0' || line[0] == '#')
+			continue ;
+		if (philo == data->num_philos || parse_set(data, line, philo) != 0)
+			error = 1;
+		philo++;
+	}
+	free(line);
+	return (error || philo != data->num_philos);
+}
+
+/*
+** --topology=FILE: the first number is the resource count R, followed by
+** one line per philosopher listing the resource indices (0..R-1) it needs
+** to eat. Resources replace the ring's forks one for one.
+*/
+int	topology_load(t_data *data)
+{
+	FILE	*file;
+
+	file = fopen(data->opts.topology, "r");
+	if (!file)
+		return (printf("%s %s\n", ERR_TOPOLOGY, data->opts.topology), 1);
+	if (fscanf(file, "%d", &data->num_forks) != 1 || data->num_forks <= 0)
+		return (fclose(file), printf("%s %s\n", ERR_TOPOLOGY,
+				data->opts.topology), 1);
+	data->res_index = calloc(data->num_philos + 1, sizeof(int));
+	data->res_list = malloc(sizeof(int) * data->num_philos
+			* TOPO_MAX_DEGREE);
+	if (!data->res_index || !data->res_list || read_sets(data, file) != 0)
+		return (fclose(file), topology_free(data), printf("%s %s\n",
+				ERR_TOPOLOGY, data->opts.topology), 1);
+	fclose(file);
+	return (0);
+}
+
+void	topology_free(t_data *data)
+{
+	free(data->res_index);
+	free(data->res_list);
+	data->res_index = NULL;
+	data->res_list = NULL;
+}
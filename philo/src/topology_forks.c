@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   topology_forks.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:55:41 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:08:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Returns one fork to the table; every release path goes through here.
+*/
+void	put_fork(t_data *data, int fork_index)
+{
+	fork_lock_acquire(&data->forks[fork_index].lock);
+	data->forks[fork_index].state = FORK_AVAILABLE;
+	data->forks[fork_index].owner_id = -1;
+	if (data->opts.latency)
+		data->forks[fork_index].released_us = get_time_us();
+	fork_lock_release(&data->forks[fork_index].lock);
+}
+
+void	assign_resources(t_philo *philo, t_data *data, int index)
+{
+	philo->res = data->res_list + data->res_index[index];
+	philo->nres = data->res_index[index + 1] - data->res_index[index];
+	philo->left_fork = philo->res[0];
+	philo->right_fork = philo->res[philo->nres - 1];
+}
+
+int	resources_available(t_philo *philo)
+{
+	int	i;
+
+	i = 0;
+	while (i < philo->nres)
+	{
+		if (!can_take_fork(philo, philo->res[i]))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/*
+** All-or-nothing acquisition in global resource order. A scan that only
+** peeks at each resource under its lock, taking nothing, first skips
+** attempts that would certainly roll back, which matters for high-degree
+** philosophers; a real conflict releases everything taken so far, so no
+** philosopher ever waits while holding a resource.
+*/
+int	take_resources(t_philo *philo)
+{
+	int	i;
+
+	if (!resources_available(philo))
+		return (0);
+	i = 0;
+	while (i < philo->nres)
+	{
+		if (!take_fork_safe(philo, philo->res[i]))
+		{
+			while (--i >= 0)
+				put_fork(philo->data, philo->res[i]);
+			stats_add(philo->data, STAT_ROLLBACKS);
+			return (0);
+		}
+		i++;
+	}
+	return (1);
+}
+
+void	release_resources(t_philo *philo)
+{
+	int	i;
+
+	i = philo->nres;
+	while (--i >= 0)
+		put_fork(philo->data, philo->res[i]);
+}
@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tune_main.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:48:30 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 11:30:05 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_tune.h"
+
+static int	parse_tune(t_tune *tune, int argc, char **argv)
+{
+	if ((argc < 5 || argc > 7) || validate_args(argc, argv))
+		return (1);
+	tune->n_min = ft_atoi(argv[1]);
+	tune->n_max = ft_atoi(argv[2]);
+	tune->eat = ft_atoi(argv[3]);
+	tune->sleep = ft_atoi(argv[4]);
+	tune->trials = TUNE_TRIALS;
+	tune->meals = TUNE_MEALS;
+	if (argc >= 6)
+		tune->trials = ft_atoi(argv[5]);
+	if (argc == 7)
+		tune->meals = ft_atoi(argv[6]);
+	if (tune->n_min <= 1 || tune->n_max < tune->n_min || tune->eat <= 0
+		|| tune->sleep <= 0 || tune->trials <= 0 || tune->meals <= 0)
+		return (1);
+	return (0);
+}
+
+int	main(int argc, char **argv)
+{
+	t_tune		tune;
+	long long	start;
+	int			n;
+
+	memset(&tune, 0, sizeof(t_tune));
+	if (parse_tune(&tune, argc, argv) != 0)
+		return (printf("%s\n", TUNE_USAGE), 1);
+	printf("# eat=%d sleep=%d trials=%d meals=%d\n", tune.eat, tune.sleep,
+		tune.trials, tune.meals);
+	printf("#%4s %8s %11s %8s %8s %8s %11s %6s\n", "N", "min_die",
+		"survived", "wil_low", "wil_high", "max_fail", "survived", "probes");
+	start = get_time();
+	n = tune.n_min;
+	while (n <= tune.n_max)
+		tune_philos(&tune, n++);
+	start = time_elapsed(start);
+	if (start <= 0)
+		start = 1;
+	printf("# %lld trials in %.1f s (%.0f trials/min)\n", tune.trials_run,
+		start / 1000.0, tune.trials_run * 60000.0 / start);
+	prof_report();
+	return (0);
+}
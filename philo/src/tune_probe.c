@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tune_probe.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:48:30 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 10:48:30 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_tune.h"
+
+static int	init_trial(t_data *trial, t_tune *tune, t_probe *probe)
+{
+	char	buf[5][16];
+	char	*args[6];
+
+	snprintf(buf[0], 16, "%d", probe->num_philos);
+	snprintf(buf[1], 16, "%d", probe->die);
+	snprintf(buf[2], 16, "%d", tune->eat);
+	snprintf(buf[3], 16, "%d", tune->sleep);
+	snprintf(buf[4], 16, "%d", tune->meals);
+	args[0] = "philo-tune";
+	args[1] = buf[0];
+	args[2] = buf[1];
+	args[3] = buf[2];
+	args[4] = buf[3];
+	args[5] = buf[4];
+	if (init_data(trial, 6, args) != 0)
+		return (1);
+	trial->out = NULL;
+	if (init_philos(trial) != 0)
+		return (free_resources(trial), 1);
+	return (0);
+}
+
+/*
+** Runs probe->trials copies of the same table concurrently through the
+** multi-table runner, with logging disabled, and counts the survivors.
+*/
+int	run_probe(t_tune *tune, t_probe *probe)
+{
+	t_table_set	set;
+	int			i;
+
+	memset(&set, 0, sizeof(t_table_set));
+	set.tables = calloc(tune->trials, sizeof(t_data));
+	if (!set.tables)
+		return (1);
+	while (set.count < tune->trials)
+	{
+		if (init_trial(&set.tables[set.count], tune, probe) != 0)
+			return (free_table_set(&set), 1);
+		set.count++;
+	}
+	run_table_set(&set);
+	probe->trials = set.count;
+	probe->survived = 0;
+	i = -1;
+	while (++i < set.count)
+		probe->survived += (set.tables[i].sim_state == SIM_COMPLETED);
+	tune->trials_run += set.count;
+	free_table_set(&set);
+	return (0);
+}
+
+/*
+** 95% Wilson score interval for the survival probability of a probe.
+*/
+void	wilson_bounds(t_probe *probe, double *low, double *high)
+{
+	double	n;
+	double	p;
+	double	z2;
+	double	center;
+	double	half;
+
+	n = probe->trials;
+	*low = 0;
+	*high = 1;
+	if (n <= 0)
+		return ;
+	p = probe->survived / n;
+	z2 = TUNE_Z * TUNE_Z;
+	center = (p + z2 / (2 * n)) / (1 + z2 / n);
+	half = TUNE_Z * sqrt(p * (1 - p) / n + z2 / (4 * n * n)) / (1 + z2 / n);
+	*low = center - half;
+	*high = center + half;
+	if (*low < 0)
+		*low = 0;
+	if (*high > 1)
+		*high = 1;
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tune_search.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:48:30 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 20:34:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo_tune.h"
+
+static int	probe_passes(t_tune *tune, t_probe *probe, int die)
+{
+	probe->die = die;
+	if (run_probe(tune, probe) != 0)
+		return (-1);
+	return (probe->survived == probe->trials);
+}
+
+static void	print_row(t_probe *pass, t_probe *fail, int probes)
+{
+	double	low;
+	double	high;
+
+	wilson_bounds(pass, &low, &high);
+	printf("%5d %8d %5d/%-5d %8.2f %8.2f %8d %5d/%-5d %6d\n",
+		pass->num_philos, pass->die, pass->survived, pass->trials, low,
+		high, fail->die, fail->survived, fail->trials, probes);
+	fflush(stdout);
+}
+
+/*
+** Bisects time_to_die between fail and pass. `fail` always holds the
+** largest value seen to lose a philosopher and `pass` the smallest value
+** where every trial survived, so the boundary lies in (fail.die, pass.die].
+** Returns the number of probes run, or -1 if one could not be run.
+*/
+static int	bisect(t_tune *tune, t_probe *pass, t_probe *fail)
+{
+	t_probe	probe;
+	int		probes;
+	int		result;
+
+	probe.num_philos = pass->num_philos;
+	probes = 0;
+	while (pass->die - fail->die > 1)
+	{
+		result = probe_passes(tune, &probe, (pass->die + fail->die) / 2);
+		if (result < 0)
+			return (-1);
+		if (result)
+			*pass = probe;
+		else
+			*fail = probe;
+		probes++;
+	}
+	return (probes);
+}
+
+void	tune_philos(t_tune *tune, int num_philos)
+{
+	t_probe	pass;
+	t_probe	fail;
+	int		probes;
+
+	memset(&fail, 0, sizeof(t_probe));
+	fail.die = tune->eat;
+	pass.num_philos = num_philos;
+	if (probe_passes(tune, &pass, 4 * (tune->eat + tune->sleep)) != 1)
+		return ((void)printf("%5d   infeasible up to %d\n", num_philos,
+				pass.die));
+	probes = bisect(tune, &pass, &fail);
+	if (probes < 0)
+		return ((void)printf("%5d   probe failed\n", num_philos));
+	print_row(&pass, &fail, probes + 1);
+}
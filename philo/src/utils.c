@@ -6,7 +6,7 @@
 /*   By: snakajim <snakajim@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/12 15:17:45 by snakajim          #+#    #+#             */
-/*   Updated: 2025/04/12 15:20:58 by snakajim         ###   ########.fr       */
+/*   Updated: 2026/10/19 19:07:44 by nassy            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -70,7 +70,9 @@ void	ft_usleep(long long time)
 			usleep(200);
 		else
 			usleep(50);
+		acct_wakeup();
 	}
+	jitter_delay();
 }
 
 int	is_state(t_data *data, int target_state)
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watchdog.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:31:26 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 22:06:40 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+void	watchdog_init(t_data *data)
+{
+	memset(&data->watch, 0, sizeof(t_watch));
+	data->watch.expected = ring_rate(data) * data->opts.watchdog / 100.0;
+}
+
+static double	window_rate(t_watch *watch)
+{
+	int	newest;
+	int	oldest;
+
+	oldest = watch->head;
+	newest = (watch->head + WATCH_SAMPLES - 1) % WATCH_SAMPLES;
+	watch->window = watch->time[newest] - watch->time[oldest];
+	if (watch->window <= 0)
+		return (watch->expected);
+	return ((watch->meals[newest] - watch->meals[oldest]) * 1000.0
+		/ watch->window);
+}
+
+/*
+** Stores one sample in the ring; returns 0 until the ring has filled. The
+** interval and the expected rate follow the timings in force now, which
+** --scenario changes during the run, and a window is held to the lowest
+** expectation among its samples so a phase change never reads as a stall.
+*/
+static int	watch_push(t_data *data, long long now)
+{
+	t_watch	*watch;
+	int		i;
+
+	watch = &data->watch;
+	watch->interval = 2 * (live_eat(data) + live_sleep(data))
+		/ (WATCH_SAMPLES - 1);
+	if (watch->interval < 1)
+		watch->interval = 1;
+	watch->next_sample = now + watch->interval;
+	watch->time[watch->head] = now;
+	watch->meals[watch->head] = total_meals(data);
+	watch->expect[watch->head] = ring_rate(data) * data->opts.watchdog / 100.0;
+	watch->head = (watch->head + 1) % WATCH_SAMPLES;
+	if (watch->count < WATCH_SAMPLES)
+		return (watch->count++, 0);
+	watch->expected = watch->expect[0];
+	i = 0;
+	while (++i < WATCH_SAMPLES)
+		if (watch->expect[i] < watch->expected)
+			watch->expected = watch->expect[i];
+	return (1);
+}
+
+/*
+** Called from every monitor pass. Every `interval` ms it records the
+** global meal count in a ring of WATCH_SAMPLES samples, which spans about
+** two eat+sleep cycles; once the ring is full, a window rate under the
+** configured share of the ring maximum opens a stall episode and prints
+** one report. The episode closes when the rate recovers.
+*/
+void	watchdog_sample(t_data *data)
+{
+	t_watch		*watch;
+	long long	now;
+	double		rate;
+
+	watch = &data->watch;
+	now = get_time();
+	if (!data->opts.watchdog || now < watch->next_sample)
+		return ;
+	if (!watch_push(data, now))
+		return ;
+	rate = window_rate(watch);
+	if (rate < watch->expected && !watch->stalled)
+	{
+		watch->stalled = 1;
+		watch->stalls++;
+		stall_report(data, rate);
+	}
+	else if (rate >= watch->expected)
+		watch->stalled = 0;
+}
+
+void	report_watchdog(t_data *data)
+{
+	if (!data->opts.watchdog)
+		return ;
+	if (data->scenario)
+		fprintf(stderr, "watchdog: %lld stall episode(s) below %d%% of the "
+			"ring maximum\n", data->watch.stalls, data->opts.watchdog);
+	else
+		fprintf(stderr, "watchdog: %lld stall episode(s) below %.2f "
+			"meals/s\n", data->watch.stalls, data->watch.expected);
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   watchdog_report.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: nassy <nassy@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:31:26 by nassy             #+#    #+#             */
+/*   Updated: 2026/10/19 21:44:51 by nassy            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "philo.h"
+
+/*
+** Copies fork owners and times since each meal; returns the philosopher
+** that has gone longest without eating.
+*/
+static int	snapshot(t_data *data, int *owners, long long *since)
+{
+	int	worst;
+	int	i;
+
+	i = -1;
+	while (++i < data->num_forks)
+	{
+		fork_lock_acquire(&data->forks[i].lock);
+		owners[i] = -1;
+		if (data->forks[i].state == FORK_IN_USE)
+			owners[i] = data->forks[i].owner_id;
+		fork_lock_release(&data->forks[i].lock);
+	}
+	worst = 0;
+	i = -1;
+	while (++i < data->num_philos)
+	{
+		since[i] = time_since_last_meal(&data->philos[i]);
+		if (since[i] > since[worst])
+			worst = i;
+	}
+	return (worst);
+}
+
+/*
+** First fork this philosopher needs that somebody else holds, or -1.
+*/
+static int	blocking_fork(t_philo *philo, int *owners)
+{
+	int	ring[2];
+	int	*need;
+	int	count;
+	int	i;
+
+	ring[0] = philo->left_fork;
+	ring[1] = philo->right_fork;
+	need = ring;
+	count = 2;
+	if (philo->res)
+	{
+		need = philo->res;
+		count = philo->nres;
+	}
+	i = -1;
+	while (++i < count)
+		if (owners[need[i]] > 0 && owners[need[i]] != philo->id)
+			return (need[i]);
+	return (-1);
+}
+
+/*
+** Follows "waits for a fork held by" edges from the stalled philosopher
+** until a free fork, a philosopher that is not blocked, or a cycle.
+*/
+static void	print_chain(t_data *data, int *owners, int start)
+{
+	int	philo;
+	int	fork;
+	int	steps;
+
+	fprintf(stderr, "  chain: %d", start + 1);
+	philo = start;
+	steps = 0;
+	while (steps++ < data->num_philos)
+	{
+		fork = blocking_fork(&data->philos[philo], owners);
+		if (fork < 0)
+			break ;
+		fprintf(stderr, " -> fork %d -> %d", fork, owners[fork]);
+		philo = owners[fork] - 1;
+		if (philo == start)
+		{
+			fprintf(stderr, " (cycle)");
+			break ;
+		}
+	}
+	fprintf(stderr, "\n");
+}
+
+/*
+** Lists the STALL_ROWS philosophers with the longest time since progress,
+** picking the current maximum and then blanking it.
+*/
+static void	print_philos(t_data *data, int *owners, long long *since)
+{
+	int	printed;
+	int	worst;
+	int	fork;
+	int	i;
+
+	printed = 0;
+	while (printed < STALL_ROWS && printed < data->num_philos)
+	{
+		worst = 0;
+		i = 0;
+		while (++i < data->num_philos)
+			if (since[i] > since[worst])
+				worst = i;
+		fork = blocking_fork(&data->philos[worst], owners);
+		fprintf(stderr, "  philo %d since_progress=%lldms", worst + 1,
+			since[worst]);
+		if (fork >= 0)
+			fprintf(stderr, " waits_for_fork=%d held_by=%d", fork,
+				owners[fork]);
+		fprintf(stderr, "\n");
+		since[worst] = -1;
+		printed++;
+	}
+}
+
+void	stall_report(t_data *data, double rate)
+{
+	int			*owners;
+	long long	*since;
+	int			worst;
+
+	owners = malloc(sizeof(int) * data->num_forks);
+	since = malloc(sizeof(long long) * data->num_philos);
+	if (!owners || !since)
+	{
+		free(owners);
+		free(since);
+		return ;
+	}
+	worst = snapshot(data, owners, since);
+	fprintf(stderr, "STALL t=%lldms rate=%.2f/s expected>=%.2f/s "
+		"window=%lldms\n", time_elapsed(data->start_time), rate,
+		data->watch.expected, data->watch.window);
+	print_chain(data, owners, worst);
+	print_philos(data, owners, since);
+	free(owners);
+	free(since);
+}